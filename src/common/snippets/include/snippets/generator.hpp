@@ -119,6 +119,13 @@ public:
     code generate(std::shared_ptr<ov::Model>& m, const void* compile_params = nullptr) const;
 
 protected:
+    /**
+     * @brief generates the code for the model with reductions: the innermost dimension is iterated in several stages,
+     * since the consumers of the reductions need the whole row to be accumulated
+     */
+    code generate_with_reductions(std::shared_ptr<ov::Model>& m, const void* compile_params) const;
+
+
     std::shared_ptr<TargetMachine> target;
 };
 
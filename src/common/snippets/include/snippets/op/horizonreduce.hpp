@@ -0,0 +1,43 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+#include "reduce.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface HorizonReduce
+ * @brief Generated by the code generator after the inner tiles of the Reduce accumulator: reduces the lanes
+ * of the vector register and broadcasts the result to all of them
+ * @ingroup snippets
+ */
+class HorizonReduce : public ngraph::op::Op {
+public:
+    OPENVINO_OP("HorizonReduce", "SnippetsOpset");
+
+    HorizonReduce(const Output<Node>& x, Reduce::Type type);
+    HorizonReduce() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    Reduce::Type get_reduce_type() const {
+        return m_type;
+    }
+
+private:
+    Reduce::Type m_type = Reduce::Type::Sum;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
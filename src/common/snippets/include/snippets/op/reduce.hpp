@@ -0,0 +1,54 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Reduce
+ * @brief Generated by Canonicalization from the reductions along the innermost dimension.
+ * The output register is an accumulator: it's kept alive during the whole kernel and combined with the input
+ * on each iteration of the inner tiles. The accumulator is initialized before the inner tiles and reduced
+ * horizontally (see HorizonReduce) after them, so the output is broadcasted along the innermost dimension
+ * Reduce == vector accumulation
+ * ScalarReduce == accumulation of the first lane only (tail processing)
+ * @ingroup snippets
+ */
+class Reduce : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Reduce", "SnippetsOpset");
+
+    enum class Type {
+        Sum,
+        Max
+    };
+
+    Reduce(const Output<Node>& x, Type type);
+    Reduce() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    Type get_reduce_type() const {
+        return m_type;
+    }
+
+    // The value the accumulator is initialized with
+    float get_identity_value() const;
+
+protected:
+    Type m_type = Type::Sum;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -0,0 +1,34 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+#include "reduce.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface ScalarReduce
+ * @brief Generated by Canonicalization for the accumulation of a scalar value (loaded to the first lane of the vector register)
+ * @ingroup snippets
+ */
+class ScalarReduce : public Reduce {
+public:
+    OPENVINO_OP("ScalarReduce", "SnippetsOpset", ngraph::snippets::op::Reduce);
+
+    ScalarReduce(const Output<Node>& x, Type type);
+    ScalarReduce() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<ScalarReduce>(new_args.at(0), m_type);
+    }
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
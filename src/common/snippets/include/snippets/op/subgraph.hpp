@@ -108,6 +108,14 @@ public:
 
     static auto wrap_node_as_subgraph(const std::shared_ptr<ngraph::Node>& node) -> std::shared_ptr<Subgraph>;
 
+    // Precision of the data in memory for a body parameter or result. The body is always executed in its own
+    // precision (f32), so the loads and stores convert the data if the precision passed to canonicalize differs
+    static element::Type get_memory_precision(const std::shared_ptr<const ov::Node>& node);
+
+    // Whether the body contains the reductions along the innermost dimension. Such a body is executed in stages
+    // (see Generator), so the innermost dimension can't be collapsed with the outer ones.
+    bool has_reductions() const;
+
 private:
     void convert_to_snippet_dialect();
     Shape exec_domain;
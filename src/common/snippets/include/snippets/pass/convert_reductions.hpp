@@ -0,0 +1,45 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ConvertReductions
+ * @brief Replaces ReduceSum, ReduceMax and ReduceMean along the innermost dimension with snippets::op::Reduce.
+ * ReduceMean is supported only if the innermost dimension is static, since it's converted to the multiplication
+ * of the sum by the scalar.
+ * @ingroup snippets
+ */
+class ConvertReductions: public ngraph::pass::MatcherPass {
+public:
+    ConvertReductions();
+};
+
+/**
+ * @interface SoftmaxDecomposition
+ * @brief Decomposes Softmax along the innermost dimension to exp(x - max(x)) / sum(exp(x - max(x)))
+ * with the snippets::op::Reduce ops.
+ * @ingroup snippets
+ */
+class SoftmaxDecomposition: public ngraph::pass::MatcherPass {
+public:
+    SoftmaxDecomposition();
+};
+
+/**
+ * @brief Returns true if the node is a reduction along the innermost dimension which can be converted by the passes above
+ * @ingroup snippets
+ */
+bool is_supported_reduction(const std::shared_ptr<const Node>& node);
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
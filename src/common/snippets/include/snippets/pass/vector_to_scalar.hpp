@@ -35,6 +35,17 @@ public:
     ReplaceStoresWithScalarStores();
 };
 
+/**
+ * @interface ReplaceReducesWithScalarReduces
+ * @brief Replaces vector reductions with scalar versions, which accumulate only the first lane.
+ * Used for tail generation
+ * @ingroup snippets
+ */
+class ReplaceReducesWithScalarReduces: public ngraph::pass::MatcherPass {
+public:
+    ReplaceReducesWithScalarReduces();
+};
+
 } // namespace pass
 } // namespace snippets
 } // namespace ngraph
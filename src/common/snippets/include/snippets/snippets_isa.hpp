@@ -13,9 +13,12 @@
 #include "op/broadcastmove.hpp"
 #include "op/kernel.hpp"
 #include "op/load.hpp"
+#include "op/horizonreduce.hpp"
 #include "op/nop.hpp"
+#include "op/reduce.hpp"
 #include "op/scalar.hpp"
 #include "op/scalarload.hpp"
+#include "op/scalarreduce.hpp"
 #include "op/scalarstore.hpp"
 #include "op/powerstatic.hpp"
 #include "op/store.hpp"
@@ -20,6 +20,10 @@ NGRAPH_OP(Store, ngraph::snippets::op)
 NGRAPH_OP(ScalarStore, ngraph::snippets::op)
 NGRAPH_OP(VectorStore, ngraph::snippets::op)
 
+NGRAPH_OP(Reduce, ngraph::snippets::op)
+NGRAPH_OP(ScalarReduce, ngraph::snippets::op)
+NGRAPH_OP(HorizonReduce, ngraph::snippets::op)
+
 NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
 NGRAPH_OP(Scalar, ngraph::snippets::op)
 NGRAPH_OP(Nop, ngraph::snippets::op)
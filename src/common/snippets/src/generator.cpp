@@ -8,10 +8,81 @@
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/op/tile.hpp"
 #include "snippets/op/kernel.hpp"
+#include "snippets/op/subgraph.hpp"
 #include <snippets/itt.hpp>
 
 #include <ngraph/pass/manager.hpp>
 
+namespace {
+using EmitterCode = std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>;
+
+auto is_row_store(const std::shared_ptr<ov::Node>& n) -> bool {
+    return ov::is_type<ngraph::snippets::op::Store>(n) && n->get_input_shape(0).back() == 1;
+}
+
+// The consumers of a reduction are executed only after the whole row is accumulated, so each Reduce starts
+// a new stage for them
+auto get_stages(const std::shared_ptr<ov::Model>& m) -> std::map<std::shared_ptr<ov::Node>, size_t> {
+    std::map<std::shared_ptr<ov::Node>, size_t> stages;
+    for (const auto& n : m->get_ordered_ops()) {
+        size_t stage = 0;
+        for (const auto& input : n->input_values()) {
+            const auto source = input.get_node_shared_ptr();
+            stage = std::max(stage, stages[source] + (ov::is_type<ngraph::snippets::op::Reduce>(source) ? 1 : 0));
+        }
+        stages[n] = stage;
+    }
+    return stages;
+}
+
+// Ops required to compute the targets in the topological order. The reductions which are not targets
+// are already computed and kept in the registers, so they aren't emitted again.
+auto get_ops_for(const std::shared_ptr<ov::Model>& m, const std::set<std::shared_ptr<ov::Node>>& targets) -> ov::NodeVector {
+    std::set<std::shared_ptr<ov::Node>> required;
+    std::vector<std::shared_ptr<ov::Node>> to_visit(targets.begin(), targets.end());
+    while (!to_visit.empty()) {
+        const auto n = to_visit.back();
+        to_visit.pop_back();
+        if (required.count(n) || ov::is_type<ov::op::v0::Parameter>(n) ||
+            (ov::is_type<ngraph::snippets::op::Reduce>(n) && !targets.count(n)))
+            continue;
+        required.insert(n);
+        for (const auto& input : n->input_values())
+            to_visit.push_back(input.get_node_shared_ptr());
+    }
+    ov::NodeVector ops;
+    for (const auto& n : m->get_ordered_ops()) {
+        if (required.count(n))
+            ops.push_back(n);
+    }
+    return ops;
+}
+
+auto get_stage_ops(const std::shared_ptr<ov::Model>& m, size_t stage) -> ov::NodeVector {
+    const auto stages = get_stages(m);
+    std::set<std::shared_ptr<ov::Node>> targets;
+    for (const auto& n : m->get_ordered_ops()) {
+        if (stages.at(n) == stage &&
+            (ov::is_type<ngraph::snippets::op::Reduce>(n) || (ov::is_type<ngraph::snippets::op::Store>(n) && !is_row_store(n))))
+            targets.insert(n);
+    }
+    return get_ops_for(m, targets);
+}
+
+// Indices of the parameters which pointers are incremented by the loads of the ops
+auto get_incremented_params(const std::shared_ptr<ov::Model>& m, const ov::NodeVector& ops) -> std::set<size_t> {
+    std::set<size_t> params;
+    for (const auto& n : ops) {
+        if (ov::is_type<ngraph::snippets::op::Load>(n) && n->get_input_shape(0).back() != 1) {
+            const auto param = ov::as_type_ptr<ov::op::v0::Parameter>(n->get_input_node_shared_ptr(0));
+            if (param)
+                params.insert(m->get_parameter_index(param));
+        }
+    }
+    return params;
+}
+}   // namespace
+
 auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph::snippets::RegInfo {
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::getRegisters")
     auto rt = n->get_rt_info();
@@ -50,6 +121,10 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     auto out = results.size();
     auto nptrs = in + out;
 
+    const auto& ops = m->get_ordered_ops();
+    if (std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& n) { return ov::is_type<op::Reduce>(n); }))
+        return generate_with_reductions(m, compile_params);
+
     OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::VectorTile")
     // vector tile
     std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> lowered;
@@ -104,3 +179,129 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     OV_ITT_TASK_NEXT(GENERATE, "::GetSnippet")
     return target->get_snippet();
 }
+
+ngraph::snippets::code ngraph::snippets::Generator::generate_with_reductions(std::shared_ptr<ov::Model>& m,
+                                                                             const void* compile_params) const {
+    OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator::generate_with_reductions")
+    const auto in = m->get_parameters().size();
+    const auto out = m->get_results().size();
+    const auto nptrs = in + out;
+
+    auto m_scalar = ov::clone_model(*m.get());
+    ngraph::pass::Manager mng;
+    mng.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
+    mng.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    mng.register_pass<ngraph::snippets::pass::ReplaceReducesWithScalarReduces>();
+    mng.run_passes(m_scalar);
+
+    // the same emitter may be emitted in several stages, so they are created once per op
+    std::map<std::shared_ptr<ov::Node>, std::shared_ptr<Emitter>> emitters;
+    std::vector<std::shared_ptr<Emitter>> aux_emitters;
+    auto lower = [&](const ov::NodeVector& ops) {
+        EmitterCode lowered;
+        for (auto n : ops) {
+            auto& emitter = emitters[n];
+            if (!emitter)
+                emitter = target->get(n->get_type_info())(n);
+            lowered.push_back(std::make_pair(emitter, ngraph::snippets::getRegisters(n)));
+        }
+        return lowered;
+    };
+    auto accumulator_reg = [](std::shared_ptr<ov::Node> reduce) {
+        return ngraph::snippets::getRegisters(reduce).second.at(0);
+    };
+
+    const auto stages = get_stages(m);
+    size_t num_stages = 0;
+    for (const auto& stage : stages)
+        num_stages = std::max(num_stages, stage.second + 1);
+
+    std::vector<ov::NodeVector> vector_stages(num_stages), scalar_stages(num_stages);
+    for (size_t s = 0; s < num_stages; s++) {
+        vector_stages[s] = get_stage_ops(m, s);
+        scalar_stages[s] = get_stage_ops(m_scalar, s);
+    }
+
+    // Each stage iterates over the innermost dimension: the accumulators of the stage are initialized,
+    // then the vector and scalar tiles are executed and the accumulators are reduced horizontally.
+    // The loads increment the pointers, so they are rewound if the same data is read by the following stages.
+    // The stores of the reduced values are performed once per row after all the stages.
+    EmitterCode outer_region;
+    for (size_t s = 0; s < num_stages; s++) {
+        if (vector_stages[s].empty())
+            continue;
+        ov::NodeVector reductions;
+        for (const auto& n : vector_stages[s]) {
+            if (ov::is_type<op::Reduce>(n) && stages.at(n) == s)
+                reductions.push_back(n);
+        }
+
+        for (const auto& reduce : reductions) {
+            const auto value = ov::as_type_ptr<op::Reduce>(reduce)->get_identity_value();
+            auto init = std::make_shared<op::Scalar>(element::f32, Shape{1}, value);
+            aux_emitters.push_back(target->get(op::Scalar::get_type_info_static())(init));
+            outer_region.push_back(std::make_pair(aux_emitters.back(),
+                                                  std::make_pair(std::vector<size_t>{}, std::vector<size_t>{accumulator_reg(reduce)})));
+        }
+
+        auto tile = std::make_shared<ngraph::snippets::op::Tile>(lower(vector_stages[s]));
+        tile->compile_params = compile_params;
+        outer_region.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                                              std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
+
+        std::vector<size_t> scalar_tile_args{1, target->get_lanes(), nptrs, 1};
+        std::set<size_t> read_later;
+        for (size_t next = s + 1; next < num_stages; next++) {
+            const auto params = get_incremented_params(m, vector_stages[next]);
+            read_later.insert(params.begin(), params.end());
+        }
+        const auto read_now = get_incremented_params(m, vector_stages[s]);
+        std::vector<size_t> rewinds(nptrs, 0);
+        bool need_rewinds = false;
+        for (auto i : read_now) {
+            if (read_later.count(i)) {
+                rewinds[i] = op::Subgraph::get_memory_precision(m->get_parameters()[i]).size();
+                need_rewinds = true;
+            }
+        }
+        if (need_rewinds)
+            scalar_tile_args.insert(scalar_tile_args.end(), rewinds.begin(), rewinds.end());
+        tile = std::make_shared<ngraph::snippets::op::Tile>(lower(scalar_stages[s]));
+        tile->compile_params = compile_params;
+        outer_region.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                                              std::make_pair(scalar_tile_args, std::vector<size_t>{})));
+
+        for (const auto& reduce : reductions) {
+            const auto type = ov::as_type_ptr<op::Reduce>(reduce)->get_reduce_type();
+            auto horizon = std::make_shared<op::HorizonReduce>(reduce, type);
+            aux_emitters.push_back(target->get(op::HorizonReduce::get_type_info_static())(horizon));
+            const auto reg = accumulator_reg(reduce);
+            outer_region.push_back(std::make_pair(aux_emitters.back(),
+                                                  std::make_pair(std::vector<size_t>{reg}, std::vector<size_t>{reg})));
+        }
+    }
+
+    std::set<std::shared_ptr<ov::Node>> row_stores;
+    for (const auto& n : m_scalar->get_ordered_ops()) {
+        if (is_row_store(n))
+            row_stores.insert(n);
+    }
+    const auto row_lowered = lower(get_ops_for(m_scalar, row_stores));
+    outer_region.insert(outer_region.end(), row_lowered.begin(), row_lowered.end());
+
+    EmitterCode tiles2D;
+    auto tile = std::make_shared<ngraph::snippets::op::Tile>(outer_region);
+    tile->compile_params = compile_params;
+    tiles2D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                                     std::make_pair(std::vector<size_t>({1, 0, nptrs, 0}), std::vector<size_t>{})));
+
+    auto tiles2DKernel = std::make_shared<ngraph::snippets::op::Kernel>(tiles2D);
+    tiles2DKernel->compile_params = compile_params;
+    std::shared_ptr<Emitter> kernel = target->get(ngraph::snippets::op::Kernel::get_type_info_static())(tiles2DKernel);
+    kernel->emit_code({in, out}, {});
+    for (const auto& emitter : emitters)
+        emitter.second->emit_data();
+    for (const auto& emitter : aux_emitters)
+        emitter->emit_data();
+    return target->get_snippet();
+}
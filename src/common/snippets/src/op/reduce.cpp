@@ -0,0 +1,40 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/reduce.hpp"
+
+#include <limits>
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::Reduce::Reduce(const Output<Node>& x, Type type) : Op({x}), m_type(type) {
+    constructor_validate_and_infer_types();
+}
+
+bool snippets::op::Reduce::visit_attributes(AttributeVisitor& visitor) {
+    std::string type = m_type == Type::Sum ? "sum" : "max";
+    visitor.on_attribute("type", type);
+    return true;
+}
+
+std::shared_ptr<Node> snippets::op::Reduce::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(Reduce);
+    check_new_args_count(this, new_args);
+    return std::make_shared<Reduce>(new_args.at(0), m_type);
+}
+
+void snippets::op::Reduce::validate_and_infer_types() {
+    auto pshape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, pshape.rank().is_static() && pshape.rank().get_length() > 0,
+                          "Reduce supports only inputs of static non-zero rank");
+    pshape[pshape.rank().get_length() - 1] = 1;
+    set_output_type(0, get_input_element_type(0), pshape);
+}
+
+float snippets::op::Reduce::get_identity_value() const {
+    return m_type == Type::Sum ? 0.f : std::numeric_limits<float>::lowest();
+}
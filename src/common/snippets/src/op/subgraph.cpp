@@ -12,6 +12,7 @@
 #include "snippets/pass/assign_registers.hpp"
 #include "snippets/pass/convert_constants_to_scalars.hpp"
 #include "snippets/pass/convert_power_to_powerstatic.hpp"
+#include "snippets/pass/convert_reductions.hpp"
 #include "snippets/pass/vector_to_scalar.hpp"
 
 #include <ngraph/pass/manager.hpp>
@@ -24,6 +25,16 @@
 using namespace std;
 using namespace ngraph;
 
+namespace {
+void set_memory_precision(const std::shared_ptr<ov::Node>& node, const element::Type& precision) {
+    auto& rt = node->get_rt_info();
+    if (precision == node->get_element_type())
+        rt.erase("memoryPrecision");
+    else
+        rt["memoryPrecision"] = precision;
+}
+}   // namespace
+
 void snippets::op::Subgraph::set_generator(std::shared_ptr<ngraph::snippets::Generator> generator) {
     m_generator = generator;
 }
@@ -175,9 +186,12 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
         NODE_VALIDATION_CHECK(this,
                               PartialShape::broadcast_merge_into(tmpPShape, inShape, ::ngraph::op::AutoBroadcastType::NUMPY),
                               "Failed to create broadcastable shapes in snippets canonicalization");
-        const auto paramShape = m_body->get_parameters()[i]->get_shape();
-        if (paramShape.size() != inShape.size() || !equal(paramShape.begin(), paramShape.end(), inShape.begin()))
-                m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(inType, inShape));
+        // the body parameters are dynamic until the first canonicalization if the subgraph has dynamic inputs
+        const auto& param = m_body->get_parameters()[i];
+        const auto& paramShape = param->get_partial_shape();
+        if (paramShape.is_dynamic() || paramShape.to_shape() != inShape)
+                m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(param->get_element_type(), inShape));
+        set_memory_precision(m_body->get_parameters()[i], inType);
     }
 
     m_body->validate_nodes_and_infer_types();
@@ -213,10 +227,34 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
                                                                ::ngraph::op::AutoBroadcastType::NUMPY);
         NODE_VALIDATION_CHECK(this, compatibleWithOtherOutputs, "Snippets output shapes must be numpy broadcastable");
     }
+    for (size_t i = 0; i < body_results.size(); i++)
+        set_memory_precision(body_results[i], std::get<2>(outputShapes[i]));
+    // The reduced outputs are broadcastable to the other ones, but the innermost dimension is iterated
+    // in accordance with the reduction input
+    for (const auto& op : m_body->get_ordered_ops()) {
+        if (snippets::pass::is_supported_reduction(op)) {
+            NODE_VALIDATION_CHECK(this, PartialShape::broadcast_merge_into(outPShape, op->get_input_shape(0),
+                                                                           ::ngraph::op::AutoBroadcastType::NUMPY),
+                                  "Snippets reduction input shape must be broadcastable to the output shapes");
+        }
+    }
     exec_domain = outPShape.get_shape();
     return exec_domain;
 }
 
+bool snippets::op::Subgraph::has_reductions() const {
+    const auto& ops = m_body->get_ops();
+    return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& op) {
+        return ov::is_type<snippets::op::Reduce>(op) || snippets::pass::is_supported_reduction(op);
+    });
+}
+
+element::Type snippets::op::Subgraph::get_memory_precision(const std::shared_ptr<const ov::Node>& node) {
+    const auto& rt = node->get_rt_info();
+    const auto it = rt.find("memoryPrecision");
+    return it != rt.end() ? it->second.as<element::Type>() : node->get_element_type();
+}
+
 void snippets::op::Subgraph::convert_to_snippet_dialect() {
     INTERNAL_OP_SCOPE(Subgraph);
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::convert_to_snippet_dialect")
@@ -224,6 +262,9 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
         return n->get_input_shape(0).back() != 1;
     };
     ngraph::pass::Manager manager;
+    // the reductions must be converted while the axes are still constants
+    manager.register_pass<snippets::pass::SoftmaxDecomposition>();
+    manager.register_pass<snippets::pass::ConvertReductions>();
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
     manager.register_pass<snippets::pass::ConvertPowerToPowerStatic>();
     manager.register_pass<snippets::pass::InsertLoad>();
@@ -232,11 +273,14 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
     manager.register_pass<snippets::pass::LoadMoveBroadcastToBroadcastLoad>();
     manager.register_pass<snippets::pass::ReplaceLoadsWithScalarLoads>();
     manager.register_pass<snippets::pass::ReplaceStoresWithScalarStores>();
+    manager.register_pass<snippets::pass::ReplaceReducesWithScalarReduces>();
     if (exec_domain.back() != 1) {
         manager.get_pass_config()->
         set_callback<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>(skip_matching_domain);
         manager.get_pass_config()->
         set_callback<ngraph::snippets::pass::ReplaceStoresWithScalarStores>(skip_matching_domain);
+        manager.get_pass_config()->
+        set_callback<ngraph::snippets::pass::ReplaceReducesWithScalarReduces>(skip_matching_domain);
     }
     manager.run_passes(m_body);
 }
@@ -108,13 +108,29 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         live_intervals.insert(std::make_pair(i, find_last_use(i)));
     }
 
+    // The Reduce accumulators are updated on each iteration of the inner tiles and are consumed after them
+    // (possibly, by the ops which are emitted again in the following stages), so their registers are reserved
+    // for the whole kernel and aren't involved into the linear scan
+    const int vec_regs_count = 16;
+    std::map<Reg, Reg> register_map;
+    std::set<Reg> accumulators;
+    for (const auto& op : stmts) {
+        if (ov::is_type<snippets::op::Reduce>(op)) {
+            const auto reg = regs[op->output(0).get_tensor_ptr()];
+            register_map[reg] = vec_regs_count - 1 - accumulators.size();
+            accumulators.insert(reg);
+        }
+    }
+    const int bank_size = vec_regs_count - static_cast<int>(accumulators.size());
+
     // http://web.cs.ucla.edu/~palsberg/course/cs132/linearscan.pdf
     std::multiset<std::pair<int, int>, by_ending> active;
-    std::map<Reg, Reg> register_map;
     std::stack<Reg> bank;
-    for (int i = 0; i < 16; i++) bank.push(16-1-i);
+    for (int i = 0; i < bank_size; i++) bank.push(bank_size-1-i);
 
     for (auto interval : live_intervals) {
+        if (accumulators.count(interval.first))
+            continue;
         // check expired
         while (!active.empty()) {
             auto x = *active.begin();
@@ -125,7 +141,7 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
             bank.push(register_map[x.first]);
         }
         // allocate
-        if (active.size() == 16) {
+        if (static_cast<int>(active.size()) == bank_size) {
             throw ngraph_error("caanot allocate registers for a snippet ");
         } else {
             register_map[interval.first] = bank.top();
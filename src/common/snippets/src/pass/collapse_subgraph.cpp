@@ -6,6 +6,7 @@
 #include <snippets/itt.hpp>
 
 #include "snippets/pass/collapse_subgraph.hpp"
+#include "snippets/pass/convert_reductions.hpp"
 #include "snippets/op/subgraph.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
@@ -33,6 +34,15 @@ namespace {
 
 auto outputs_are_not_broadcastable(const std::shared_ptr<const Node>& node) -> bool {
     auto outputs = node->outputs();
+    // The broadcasting of dynamic outputs can't be checked until the inference, so they are accepted
+    // only if they are known to be equal
+    const auto is_dynamic = [](const Output<const Node>& output) { return output.get_partial_shape().is_dynamic(); };
+    if (std::any_of(std::begin(outputs), std::end(outputs), is_dynamic)) {
+        const auto& ref_pshape = outputs.begin()->get_partial_shape();
+        return std::any_of(std::begin(outputs), std::end(outputs), [&ref_pshape](const Output<const Node>& output) {
+            return output.get_partial_shape() != ref_pshape;
+        });
+    }
     auto find_smallest_output_shape = [](const std::vector<Output<const Node>>& outputs) -> Shape {
         return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
             [](Shape& other_shape, const Output<const Node>& output){
@@ -102,10 +112,19 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
     return is_layout_oblivious_unary(n) || is_layout_oblivious_binary(n);
 }
 
+auto is_tokenizable_reduction(const std::shared_ptr<const Node> &n) -> bool {
+    if (!ngraph::snippets::pass::is_supported_reduction(n))
+        return false;
+    // the reduced dimension is kept as 1, so the reductions can't be chained within the subgraph
+    const auto& last_dim = *n->get_input_partial_shape(0).rbegin();
+    return last_dim.is_dynamic() || last_dim.get_length() != 1;
+}
+
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
     auto supported = [](descriptor::Tensor& t) -> bool {
+        // dynamic dimensions are resolved by the canonicalization, but the rank must be known to tokenize the node
         return t.get_element_type() == ngraph::element::f32 &&
-               t.get_partial_shape().is_static();
+               t.get_partial_shape().rank().is_static();
     };
     const auto & inputs = n->inputs();
     const auto & outputs = n->outputs();
@@ -117,7 +136,9 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    // the reduction axes are the scalar constant, which is moved to the body
+    const auto data_inputs_end = ngraph::snippets::pass::is_supported_reduction(n) ? inputs.begin() + 1 : inputs.end();
+    return std::all_of(inputs.begin(), data_inputs_end, [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -164,7 +185,7 @@ auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &sub
 } // namespace
 
 bool AppropriateForSubgraph(const std::shared_ptr<const Node> &node) {
-    return is_layout_oblivious(node) && has_supported_in_out(node);
+    return (is_layout_oblivious(node) || is_tokenizable_reduction(node)) && has_supported_in_out(node);
 }
 
 void SetSnippetsNodeType(const std::shared_ptr<Node> &node, SnippetsNodeType nodeType) {
@@ -0,0 +1,102 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "snippets/snippets_isa.hpp"
+#include "snippets/pass/convert_reductions.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+bool ngraph::snippets::pass::is_supported_reduction(const std::shared_ptr<const Node>& node) {
+    const bool is_softmax = ov::is_type<opset1::Softmax>(node) || ov::is_type<opset8::Softmax>(node);
+    const bool is_reduce = ov::is_type<opset1::ReduceSum>(node) || ov::is_type<opset1::ReduceMax>(node) ||
+                           ov::is_type<opset1::ReduceMean>(node);
+    if (!is_softmax && !is_reduce)
+        return false;
+
+    const auto& pshape = node->get_input_partial_shape(0);
+    if (pshape.rank().is_dynamic() || pshape.rank().get_length() == 0)
+        return false;
+    const auto rank = pshape.rank().get_length();
+    const auto& last_dim = pshape[rank - 1];
+
+    if (const auto softmax = ov::as_type_ptr<const opset1::Softmax>(node))
+        return softmax->get_axis() == static_cast<size_t>(rank - 1);
+    if (const auto softmax = ov::as_type_ptr<const opset8::Softmax>(node))
+        return softmax->get_axis() == -1 || softmax->get_axis() == rank - 1;
+
+    // the mean is calculated with the scale known at the compile time, while the dynamic kernels are shape agnostic
+    if (ov::is_type<opset1::ReduceMean>(node) && last_dim.is_dynamic())
+        return false;
+    const auto reduce = ov::as_type_ptr<const ngraph::op::util::ArithmeticReductionKeepDims>(node);
+    return reduce->get_keep_dims() && ov::is_type<opset1::Constant>(reduce->get_input_node_shared_ptr(1)) &&
+           reduce->get_reduction_axes() == AxisSet{static_cast<size_t>(rank - 1)};
+}
+
+ngraph::snippets::pass::ConvertReductions::ConvertReductions() {
+    MATCHER_SCOPE(ConvertReductions);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<opset1::ReduceSum, opset1::ReduceMax, opset1::ReduceMean>()),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::ConvertReductions_callback")
+            auto root = m.get_match_root();
+            if (!is_supported_reduction(root) || transformation_callback(root))
+                return false;
+
+            // the dynamic innermost dimension may be equal to 1 in runtime, so nothing is reduced
+            if (*root->get_input_partial_shape(0).rbegin() == 1) {
+                ngraph::replace_node(root, {root->input_value(0)});
+                return true;
+            }
+
+            const auto type = ov::is_type<opset1::ReduceMax>(root) ? op::Reduce::Type::Max : op::Reduce::Type::Sum;
+            std::shared_ptr<Node> reduce = std::make_shared<ngraph::snippets::op::Reduce>(root->input_value(0), type);
+            NodeVector new_ops{reduce};
+            if (ov::is_type<opset1::ReduceMean>(root)) {
+                const auto work_amount = root->get_input_partial_shape(0).rbegin()->get_length();
+                auto scale = std::make_shared<ngraph::snippets::op::Scalar>(element::f32, Shape{1}, 1.f / static_cast<float>(work_amount));
+                reduce = std::make_shared<opset1::Multiply>(reduce, scale);
+                new_ops.push_back(scale);
+                new_ops.push_back(reduce);
+            }
+            reduce->set_friendly_name(root->get_friendly_name());
+            ngraph::copy_runtime_info(root, new_ops);
+            ngraph::replace_node(root, reduce);
+            return true;
+        });
+}
+
+ngraph::snippets::pass::SoftmaxDecomposition::SoftmaxDecomposition() {
+    MATCHER_SCOPE(SoftmaxDecomposition);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<opset1::Softmax, opset8::Softmax>()),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::SoftmaxDecomposition_callback")
+            auto root = m.get_match_root();
+            if (!is_supported_reduction(root) || transformation_callback(root))
+                return false;
+
+            const auto& data = root->input_value(0);
+            if (*root->get_input_partial_shape(0).rbegin() == 1) {
+                auto sub = std::make_shared<opset1::Subtract>(data, data);
+                auto exp = std::make_shared<opset1::Exp>(sub);
+                exp->set_friendly_name(root->get_friendly_name());
+                ngraph::copy_runtime_info(root, {sub, exp});
+                ngraph::replace_node(root, exp);
+                return true;
+            }
+            auto max = std::make_shared<ngraph::snippets::op::Reduce>(data, op::Reduce::Type::Max);
+            auto sub = std::make_shared<opset1::Subtract>(data, max);
+            auto exp = std::make_shared<opset1::Exp>(sub);
+            auto sum = std::make_shared<ngraph::snippets::op::Reduce>(exp, op::Reduce::Type::Sum);
+            auto div = std::make_shared<opset1::Divide>(exp, sum);
+            div->set_friendly_name(root->get_friendly_name());
+            ngraph::copy_runtime_info(root, {max, sub, exp, sum, div});
+            ngraph::replace_node(root, div);
+            return true;
+        });
+}
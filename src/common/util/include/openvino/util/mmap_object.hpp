@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific memory mapped files
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief A read-only view on the content of a file mapped into the process address space.
+ * The pages are mapped privately (copy-on-write), so a modification of the data never reaches
+ * the file and the clean pages are shared with the page cache and with other processes.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file with the name specified into memory.
+ * @param path Full or relative path to the file
+ * @return Reference to the mapped memory, the mapping is released when the last reference is gone
+ * @throws Exception if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the whole file with the wide char name specified into memory.
+ * @param path Full or relative path to the file
+ * @return Reference to the mapped memory, the mapping is released when the last reference is gone
+ * @throws Exception if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
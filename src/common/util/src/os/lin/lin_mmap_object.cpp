@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+namespace util {
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    void set(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            std::stringstream ss;
+            ss << "Can not open file " << path << " for mapping: " << std::strerror(errno);
+            throw std::runtime_error(ss.str());
+        }
+
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1) {
+            close(fd);
+            std::stringstream ss;
+            ss << "Can not get size of file " << path << ": " << std::strerror(errno);
+            throw std::runtime_error(ss.str());
+        }
+        // the size of the devices and pipes is unknown, they have to be read
+        if (!S_ISREG(sb.st_mode)) {
+            close(fd);
+            std::stringstream ss;
+            ss << "Can not map file " << path << " which is not a regular file";
+            throw std::runtime_error(ss.str());
+        }
+
+        m_size = static_cast<size_t>(sb.st_size);
+        if (m_size > 0) {
+            // MAP_PRIVATE keeps the data shared with the page cache until somebody writes to it
+            void* data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                close(fd);
+                std::stringstream ss;
+                ss << "Can not map file " << path << ": " << std::strerror(errno);
+                throw std::runtime_error(ss.str());
+            }
+            m_data = static_cast<char*>(data);
+        }
+        // the mapping stays valid after the descriptor is closed
+        close(fd);
+    }
+
+    ~MapHolder() override {
+        if (m_data != nullptr) {
+            munmap(m_data, m_size);
+        }
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    return load_mmap_object(ov::util::wstring_to_string(path));
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
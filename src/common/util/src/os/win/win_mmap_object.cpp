@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+#include <windows.h>
+
+namespace ov {
+namespace util {
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    void set(const std::string& path) {
+        m_handle = ::CreateFileA(path.c_str(),
+                                 GENERIC_READ,
+                                 FILE_SHARE_READ,
+                                 nullptr,
+                                 OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL,
+                                 nullptr);
+        map(path);
+    }
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+    void set(const std::wstring& path) {
+        m_handle = ::CreateFileW(path.c_str(),
+                                 GENERIC_READ,
+                                 FILE_SHARE_READ,
+                                 nullptr,
+                                 OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL,
+                                 nullptr);
+        map(ov::util::wstring_to_string(path));
+    }
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+    ~MapHolder() override {
+        if (m_data != nullptr) {
+            ::UnmapViewOfFile(m_data);
+        }
+        if (m_mapping != nullptr) {
+            ::CloseHandle(m_mapping);
+        }
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            ::CloseHandle(m_handle);
+        }
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    void map(const std::string& path) {
+        if (m_handle == INVALID_HANDLE_VALUE) {
+            std::stringstream ss;
+            ss << "Can not open file " << path << " for mapping. Error " << ::GetLastError();
+            throw std::runtime_error(ss.str());
+        }
+
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(m_handle, &file_size)) {
+            std::stringstream ss;
+            ss << "Can not get size of file " << path << ". Error " << ::GetLastError();
+            throw std::runtime_error(ss.str());
+        }
+
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        if (m_size > 0) {
+            // PAGE_WRITECOPY + FILE_MAP_COPY give the same copy-on-write semantic as MAP_PRIVATE
+            m_mapping = ::CreateFileMapping(m_handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            if (m_mapping == nullptr) {
+                std::stringstream ss;
+                ss << "Can not create file mapping for " << path << ". Error " << ::GetLastError();
+                throw std::runtime_error(ss.str());
+            }
+
+            m_data = static_cast<char*>(::MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0));
+            if (m_data == nullptr) {
+                std::stringstream ss;
+                ss << "Can not map file " << path << ". Error " << ::GetLastError();
+                throw std::runtime_error(ss.str());
+            }
+        }
+    }
+
+    char* m_data = nullptr;
+    size_t m_size = 0;
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -327,6 +327,11 @@ private:
     /// model and registers them, otherwise checks all the Parameters are registered.
     void prerequirements(bool detect_variables, bool detect_parameters);
 
+    /// \brief Fills the nodes from the cache of topologically sorted nodes if the cache is valid.
+    /// Must be called under m_topological_sort_mutex.
+    /// \returns false if the model has been changed since the last sort.
+    bool get_cached_ordered_ops(std::vector<std::shared_ptr<ov::Node>>& nodes) const;
+
     static std::atomic<size_t> m_next_instance_id;
     std::string m_name;
     const std::string m_unique_name;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <cstring>
 
@@ -236,6 +237,12 @@ public:
         return m_data->size();
     }
 
+    /// \brief Returns hash of the constant data
+    ///
+    /// The hash is calculated on the first call and memoized, so the repeated calls are cheap.
+    /// Copies of the Constant sharing the same data inherit the memoized value.
+    uint64_t get_data_hash() const;
+
     /// \brief Wrapper around constructing a shared_ptr of a Constant
     ///
     /// \param type The element type of the tensor constant.
@@ -690,6 +697,7 @@ private:
     }
 
     bool are_all_data_elements_bitwise_identical() const;
+    void copy_data_hash(const Constant& other);
     static constexpr size_t host_alignment() {
         return 64;
     }
@@ -711,6 +719,8 @@ private:
     std::shared_ptr<ngraph::runtime::AlignedBuffer> m_data;
     bool m_all_elements_bitwise_identical = false;
     bool m_alloc_buffer_on_visit_attributes = true;
+    mutable std::atomic<bool> m_data_hash_valid{false};
+    mutable std::atomic<uint64_t> m_data_hash{0};
 };
 }  // namespace v0
 }  // namespace op
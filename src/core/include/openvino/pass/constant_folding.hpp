@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "openvino/core/runtime_attribute.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -14,17 +16,37 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *
+ *        The parallel mode is enabled by passing the parallel for-loop of the caller's threading
+ *        runtime: the nodes which have only constant inputs are grouped into levels, the nodes
+ *        of the level are evaluated by the loop and then replaced in the topological order,
+ *        so the result doesn't depend on the number of threads. The consumers which get all
+ *        the inputs folded form the next level. The rest of the nodes are folded sequentially afterwards.
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+    /// \brief Calls the body for each index in [0, work_amount), possibly concurrently,
+    /// and returns when all the calls are finished.
+    using ParallelFor = std::function<void(size_t work_amount, const std::function<void(size_t)>& body)>;
+
+    ConstantFolding() = default;
+    explicit ConstantFolding(ParallelFor parallel_for) : m_parallel_for(std::move(parallel_for)) {}
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
 
 protected:
     void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node, const Output<Node>& replacement);
+    /// \brief Replaces the outputs of the node with the folded values.
+    /// \returns true if any output has been replaced
+    bool replace_with_folded(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+    /// \brief Folds the nodes with constant inputs level by level evaluating each level in parallel.
+    bool fold_in_parallel(const std::shared_ptr<ov::Model>& f);
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& f);
+
+private:
+    ParallelFor m_parallel_for;
 };
 
 /**
@@ -270,12 +270,7 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     lock_guard<mutex> lock(m_topological_sort_mutex);
 
     NodeVector nodes;
-    if (m_shared_rt_info->get_use_topological_cache()) {
-        for (const auto& node : m_cached_ordered_ops) {
-            if (auto locked_node = node.lock()) {
-                nodes.emplace_back(locked_node);
-            }
-        }
+    if (get_cached_ordered_ops(nodes)) {
         return nodes;
     }
 
@@ -303,6 +298,19 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     return order;
 }
 
+bool ov::Model::get_cached_ordered_ops(std::vector<std::shared_ptr<Node>>& nodes) const {
+    if (!m_shared_rt_info->get_use_topological_cache())
+        return false;
+
+    nodes.reserve(m_cached_ordered_ops.size());
+    for (const auto& node : m_cached_ordered_ops) {
+        if (auto locked_node = node.lock()) {
+            nodes.emplace_back(locked_node);
+        }
+    }
+    return true;
+}
+
 void ov::Model::map_unordered_ops(std::function<void(Node*)> f) const {
     std::unordered_set<Node*> unordered_ops;
     std::stack<Node*, std::vector<Node*>> remaining_ops;
@@ -380,6 +388,13 @@ shared_ptr<ov::Node> ov::Model::get_result() const {
 
 std::vector<shared_ptr<ov::Node>> ov::Model::get_ops() const {
     std::vector<std::shared_ptr<Node>> ops;
+    // The order of nodes is not specified here, so the unchanged model avoids the traversal
+    // by reusing the topologically sorted nodes
+    {
+        lock_guard<mutex> lock(m_topological_sort_mutex);
+        if (get_cached_ordered_ops(ops))
+            return ops;
+    }
     ngraph::traverse_nodes(this, [&](shared_ptr<Node> node) {
         ops.push_back(node);
     });
@@ -23,6 +23,14 @@
 
 using namespace std;
 
+namespace {
+void reset_topological_cache(const std::set<std::shared_ptr<ov::SharedRTInfo>>& shared_info) {
+    for (const auto& info : shared_info) {
+        info->set_use_topological_cache(false);
+    }
+}
+}  // namespace
+
 atomic<size_t> ov::Node::m_next_instance_id(0);
 
 ov::Node::Node(const Node& node)
@@ -309,10 +317,10 @@ void ov::Node::add_control_dependency(std::shared_ptr<Node> node) {
     }
 
     // control dependency may change the topological order so we have to reset cache
-    // by setting a flag into shared node info.
-    for_each(node->m_shared_rt_info.cbegin(), node->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
-        info->set_use_topological_cache(false);
-    });
+    // by setting a flag into shared node info. The dependency may be a new node which
+    // doesn't belong to any model yet, so the dependent's models are also reset.
+    reset_topological_cache(node->m_shared_rt_info);
+    reset_topological_cache(m_shared_rt_info);
 }
 
 void ov::Node::add_node_control_dependencies(std::shared_ptr<Node> source_node) {
@@ -333,6 +341,8 @@ void ov::Node::transfer_control_dependents(std::shared_ptr<Node> replacement) {
 }
 
 void ov::Node::remove_control_dependency(std::shared_ptr<Node> node) {
+    reset_topological_cache(node->m_shared_rt_info);
+    reset_topological_cache(m_shared_rt_info);
     {
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end()) {
@@ -348,6 +358,8 @@ void ov::Node::remove_control_dependency(std::shared_ptr<Node> node) {
 }
 
 void ov::Node::clear_control_dependencies() {
+    if (!m_control_dependencies.empty())
+        reset_topological_cache(m_shared_rt_info);
     for (auto& node : m_control_dependencies) {
         auto it = find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this);
         if (it != node->m_control_dependents.end()) {
@@ -211,6 +211,7 @@ ov::op::v0::Constant::Constant(const Constant& other) {
     m_shape = other.m_shape;
     m_data = other.m_data;
     m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    copy_data_hash(other);
     constructor_validate_and_infer_types();
 }
 
@@ -222,6 +223,7 @@ ov::op::v0::Constant::Constant(const Constant& other, const ov::Shape& new_shape
     m_shape = new_shape;
     m_data = other.m_data;
     m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    copy_data_hash(other);
     constructor_validate_and_infer_types();
 }
 
@@ -541,9 +543,62 @@ bool ov::op::v0::Constant::visit_attributes(AttributeVisitor& visitor) {
     }
     visitor.on_attribute("value", m_data);
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+    m_data_hash_valid = false;
     return true;
 }
 
+namespace {
+uint64_t hash_data(const char* data, size_t size) {
+    // Independent lanes don't wait for each other, so several words are processed per cycle
+    constexpr size_t lanes_num = 4;
+    constexpr size_t word_size = sizeof(uint64_t);
+    uint64_t lanes[lanes_num] = {size, 1, 2, 3};
+    auto combine = [](uint64_t seed, uint64_t value) {
+        return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+    };
+    auto load = [](const char* ptr) {
+        uint64_t word;
+        std::memcpy(&word, ptr, sizeof(word));
+        return word;
+    };
+
+    size_t i = 0;
+    for (; i + lanes_num * word_size <= size; i += lanes_num * word_size) {
+        for (size_t l = 0; l < lanes_num; l++)
+            lanes[l] = combine(lanes[l], load(data + i + l * word_size));
+    }
+    for (; i + word_size <= size; i += word_size)
+        lanes[0] = combine(lanes[0], load(data + i));
+    if (i < size) {
+        uint64_t last_bytes = 0;
+        std::memcpy(&last_bytes, data + i, size - i);
+        lanes[1] = combine(lanes[1], last_bytes);
+    }
+
+    uint64_t seed = 0;
+    for (size_t l = 0; l < lanes_num; l++)
+        seed = combine(seed, lanes[l]);
+    return seed;
+}
+}  // namespace
+
+uint64_t ov::op::v0::Constant::get_data_hash() const {
+    if (!m_data_hash_valid.load(std::memory_order_acquire)) {
+        // Concurrent callers compute the same value, so there is no need to serialize them
+        const auto size = m_data ? m_data->size() : 0;
+        m_data_hash.store(hash_data(static_cast<const char*>(get_data_ptr()), size), std::memory_order_relaxed);
+        m_data_hash_valid.store(true, std::memory_order_release);
+    }
+    return m_data_hash.load(std::memory_order_relaxed);
+}
+
+void ov::op::v0::Constant::copy_data_hash(const Constant& other) {
+    if (other.m_data_hash_valid.load(std::memory_order_acquire)) {
+        m_data_hash.store(other.m_data_hash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_data_hash_valid.store(true, std::memory_order_release);
+    }
+}
+
 bool ov::op::v0::Constant::evaluate(const HostTensorVector& outputs, const HostTensorVector& inputs) const {
     NGRAPH_OP_SCOPE(v0_Constant_evaluate);
     auto output = outputs[0];
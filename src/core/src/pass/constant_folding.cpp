@@ -4,7 +4,11 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <algorithm>
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
+
+#include "itt.hpp"
 
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/opsets/opset1.hpp"
@@ -14,8 +18,23 @@
 
 using namespace std;
 
+namespace {
+bool is_foldable_now(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_input_size() == 0 || ov::is_type<ngraph::op::Constant>(node) ||
+        node->get_rt_info().count(ov::pass::DisableConstantFolding::get_type_info_static()))
+        return false;
+    for (const auto& input : node->input_values()) {
+        if (!ov::is_type<ngraph::op::Constant>(input.get_node()))
+            return false;
+    }
+    return true;
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f) {
     bool rewritten = pre_calculated_values_folding(f);
+    if (m_parallel_for)
+        rewritten |= fold_in_parallel(f);
 
     for (const auto& node : f->get_ordered_ops()) {
         if (rewritten) {
@@ -28,27 +47,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f
         // method, so we can't always rely on attribute check inside default node->constant_fold method
         if (node->get_rt_info().count(DisableConstantFolding::get_type_info_static()) == 0 &&
             node->constant_fold(replacements, node->input_values())) {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    if (replacements.size() == 1) {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
-                    } else {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
-                                                                             std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
-            }
+            rewritten |= replace_with_folded(node, replacements);
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
@@ -63,6 +62,87 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::replace_with_folded(const std::shared_ptr<Node>& node, const OutputVector& replacements) {
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            if (replacements.size() == 1) {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            } else {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                     std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::fold_in_parallel(const std::shared_ptr<ov::Model>& f) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "ConstantFolding::fold_in_parallel");
+
+    const auto ordered_ops = f->get_ordered_ops();
+    std::unordered_map<Node*, size_t> order;
+    std::vector<std::shared_ptr<Node>> level;
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        order[ordered_ops[i].get()] = i;
+        if (is_foldable_now(ordered_ops[i]))
+            level.push_back(ordered_ops[i]);
+    }
+
+    bool rewritten = false;
+    while (!level.empty()) {
+        // Only the evaluation is performed in parallel, the model is modified by the calling thread
+        std::vector<OutputVector> replacements(level.size());
+        std::vector<uint8_t> folded(level.size(), 0);
+        m_parallel_for(level.size(), [&](size_t i) {
+            replacements[i].resize(level[i]->get_output_size());
+            folded[i] = level[i]->constant_fold(replacements[i], level[i]->input_values());
+        });
+
+        std::vector<std::shared_ptr<Node>> consumers;
+        for (size_t i = 0; i < level.size(); ++i) {
+            if (!folded[i] || !replace_with_folded(level[i], replacements[i]))
+                continue;
+            rewritten = true;
+            for (const auto& replacement : replacements[i]) {
+                for (const auto& input : replacement.get_target_inputs()) {
+                    // the consumers outside of the model (e.g. the dangling nodes not reachable from the results)
+                    // are not folded, the same as by the sequential pass
+                    if (order.count(input.get_node()))
+                        consumers.push_back(input.get_node()->shared_from_this());
+                }
+            }
+        }
+
+        // The consumers are the nodes of the original model, so they keep the topological order
+        std::sort(consumers.begin(),
+                  consumers.end(),
+                  [&order](const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) {
+                      return order.at(a.get()) < order.at(b.get());
+                  });
+        consumers.erase(std::unique(consumers.begin(), consumers.end()), consumers.end());
+
+        level.clear();
+        for (const auto& node : consumers) {
+            node->validate_and_infer_types();
+            if (is_foldable_now(node))
+                level.push_back(node);
+        }
+    }
+    return rewritten;
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                                        const Output<Node>& replacement) {
     for (auto& input : replacement.get_target_inputs()) {
@@ -937,11 +937,13 @@ void ngfunction_2_ir(pugi::xml_node& netXml,
     }
     // <edges>
     const std::vector<Edge> edge_mapping = create_edge_mapping(layer_ids, f);
+    // layer ids are the indices of the topologically sorted nodes
+    const auto ordered_ops = f.get_ordered_ops();
     pugi::xml_node edges = netXml.append_child("edges");
     for (auto e : edge_mapping) {
         // WA for LSTMCellv0, peephole input shall not be serialized
         if (e.to_port == 6) {
-            auto type_info = f.get_ordered_ops()[e.to_layer]->get_type_info();
+            auto type_info = ordered_ops[e.to_layer]->get_type_info();
             if (!strcmp(type_info.name, "LSTMCell") && type_info.version == 0) {
                 continue;
             }
@@ -1717,3 +1717,15 @@ TEST(constant, hold_host_tensor) {
     const void* constDataPtr = constOp->get_data_ptr();
     ASSERT_EQ(constDataPtr, hostDataPtr);
 }
+
+TEST(constant, data_hash) {
+    op::Constant c1(element::f32, Shape{2, 5}, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    op::Constant c2(element::f32, Shape{2, 5}, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    op::Constant c3(element::f32, Shape{2, 5}, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9, 11});
+    EXPECT_EQ(c1.get_data_hash(), c2.get_data_hash());
+    EXPECT_NE(c1.get_data_hash(), c3.get_data_hash());
+    // memoized value is stable and is inherited by the copies sharing the data
+    EXPECT_EQ(c1.get_data_hash(), c1.get_data_hash());
+    EXPECT_EQ(c1.get_data_hash(), op::Constant(c1).get_data_hash());
+    EXPECT_EQ(c1.get_data_hash(), op::Constant(c1, Shape{10}).get_data_hash());
+}
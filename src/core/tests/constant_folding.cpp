@@ -4,6 +4,7 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <thread>
 #include <transformations/utils/utils.hpp>
 
 #include "gtest/gtest.h"
@@ -3371,3 +3372,103 @@ TEST(constant_folding, constant_loop) {
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+namespace {
+// Weights decompression sub-graphs: Constant(f16) -> Convert -> Subtract(zero point) -> Multiply(scale) -> MatMul
+std::shared_ptr<Function> make_decompression_model(size_t num_weights, std::shared_ptr<op::Constant>& disabled) {
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 16});
+    Output<Node> last = data;
+    for (size_t i = 0; i < num_weights; i++) {
+        std::vector<float> values(16 * 16);
+        for (size_t j = 0; j < values.size(); j++)
+            values[j] = static_cast<float>((i * 7 + j) % 13) - 6.f;
+        auto weights = op::Constant::create(element::f16, Shape{16, 16}, values);
+        auto convert = make_shared<op::Convert>(weights, element::f32);
+        convert->set_friendly_name("convert_" + std::to_string(i));
+        auto zero_point = op::Constant::create(element::f32, Shape{16, 1}, {static_cast<float>(i % 3)});
+        auto subtract = make_shared<op::v1::Subtract>(convert, zero_point);
+        subtract->set_friendly_name("subtract_" + std::to_string(i));
+        auto scale = op::Constant::create(element::f32, Shape{16, 1}, {0.5f});
+        auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+        multiply->set_friendly_name("multiply_" + std::to_string(i));
+        last = make_shared<op::MatMul>(last, multiply);
+        if (i == num_weights / 2) {
+            // the folding mustn't go through the disabled node
+            disabled = weights;
+            ov::disable_constant_folding(convert);
+        }
+    }
+    return make_shared<Function>(OutputVector{last}, ParameterVector{data});
+}
+}  // namespace
+
+TEST(constant_folding, parallel_folding_is_equal_to_sequential) {
+    const size_t num_weights = 64;
+    std::shared_ptr<op::Constant> disabled_seq, disabled_par;
+    auto f_seq = make_decompression_model(num_weights, disabled_seq);
+    auto f_par = make_decompression_model(num_weights, disabled_par);
+
+    pass::Manager seq_manager;
+    seq_manager.register_pass<pass::ConstantFolding>();
+    seq_manager.run_passes(f_seq);
+
+    // the nodes of the level are evaluated by the several threads in the interleaved order
+    auto parallel_for = [](size_t work_amount, const std::function<void(size_t)>& body) {
+        const size_t num_threads = 4;
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < num_threads; t++) {
+            threads.emplace_back([&, t] {
+                for (size_t i = t; i < work_amount; i += num_threads)
+                    body(i);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+    };
+    pass::Manager par_manager;
+    par_manager.register_pass<pass::ConstantFolding>(parallel_for);
+    par_manager.run_passes(f_par);
+
+    // the only decompression sub-graph left is the one with the disabled Convert
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f_par), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Subtract>(f_par), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f_par), 1);
+    ASSERT_EQ(count_ops_of_type<op::MatMul>(f_par), num_weights);
+    ASSERT_EQ(disabled_par->get_output_target_inputs(0).size(), 1);
+
+    const auto ops_seq = f_seq->get_ordered_ops();
+    const auto ops_par = f_par->get_ordered_ops();
+    ASSERT_EQ(ops_seq.size(), ops_par.size());
+    for (size_t i = 0; i < ops_seq.size(); i++) {
+        ASSERT_EQ(ops_seq[i]->get_type_info(), ops_par[i]->get_type_info());
+        ASSERT_EQ(ops_seq[i]->get_friendly_name(), ops_par[i]->get_friendly_name());
+        const auto const_seq = ov::as_type_ptr<op::Constant>(ops_seq[i]);
+        const auto const_par = ov::as_type_ptr<op::Constant>(ops_par[i]);
+        if (const_seq) {
+            ASSERT_TRUE(const_par);
+            ASSERT_EQ(const_seq->get_element_type(), const_par->get_element_type());
+            ASSERT_EQ(const_seq->cast_vector<float>(), const_par->cast_vector<float>());
+        }
+    }
+}
+
+TEST(constant_folding, parallel_folding_skips_consumers_outside_of_model) {
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto weights = op::Constant::create(element::f16, Shape{2}, {1, 2});
+    auto convert = make_shared<op::Convert>(weights, element::f32);
+    auto add = make_shared<op::v1::Add>(data, convert);
+    // the consumer is not reachable from the results, so it's not a part of the model
+    auto dangling = make_shared<op::Negative>(convert);
+    auto f = make_shared<Function>(OutputVector{add}, ParameterVector{data});
+
+    auto parallel_for = [](size_t work_amount, const std::function<void(size_t)>& body) {
+        for (size_t i = 0; i < work_amount; i++)
+            body(i);
+    };
+    pass::Manager manager;
+    manager.register_pass<pass::ConstantFolding>(parallel_for);
+    ASSERT_NO_THROW(manager.run_passes(f));
+
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    ASSERT_TRUE(ov::is_type<op::Constant>(dangling->get_input_node_shared_ptr(0)));
+}
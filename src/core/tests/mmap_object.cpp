@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace std;
+
+class MmapObjectTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_file_name = ::testing::UnitTest::GetInstance()->current_test_info()->name() + string("_mmap_test.bin");
+    }
+
+    void TearDown() override {
+        std::remove(m_file_name.c_str());
+    }
+
+    void write_file(const vector<char>& content) {
+        ofstream file(m_file_name, ios::binary);
+        file.write(content.data(), content.size());
+    }
+
+    string m_file_name;
+};
+
+TEST_F(MmapObjectTest, map_file_content) {
+    vector<char> content(10000);
+    for (size_t i = 0; i < content.size(); i++)
+        content[i] = static_cast<char>(i % 127);
+    write_file(content);
+
+    auto mapped = ov::util::load_mmap_object(m_file_name);
+    ASSERT_NE(nullptr, mapped);
+    ASSERT_EQ(content.size(), mapped->size());
+    EXPECT_EQ(content, vector<char>(mapped->data(), mapped->data() + mapped->size()));
+}
+
+TEST_F(MmapObjectTest, modification_does_not_reach_file) {
+    write_file({1, 2, 3, 4});
+
+    {
+        auto mapped = ov::util::load_mmap_object(m_file_name);
+        mapped->data()[0] = 42;
+        EXPECT_EQ(42, mapped->data()[0]);
+    }
+
+    auto mapped = ov::util::load_mmap_object(m_file_name);
+    EXPECT_EQ(1, mapped->data()[0]);
+}
+
+TEST_F(MmapObjectTest, map_empty_file) {
+    write_file({});
+
+    auto mapped = ov::util::load_mmap_object(m_file_name);
+    EXPECT_EQ(0, mapped->size());
+}
+
+TEST_F(MmapObjectTest, map_missed_file) {
+    EXPECT_THROW(ov::util::load_mmap_object(m_file_name), std::runtime_error);
+}
+
+#ifndef _WIN32
+TEST_F(MmapObjectTest, map_not_regular_file) {
+    EXPECT_THROW(ov::util::load_mmap_object("/dev/zero"), std::runtime_error);
+}
+#endif
@@ -9,8 +9,12 @@
 #include <shared_node_info.hpp>
 #include <test_common.hpp>
 
+#include "ngraph/graph_util.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 TEST(model, get_input_by_tensor_name) {
     auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
@@ -1377,6 +1381,130 @@ TEST(model, topological_sort_caching_shared_nodes) {
     ASSERT_FALSE(f2_shared_info->get_use_topological_cache());
 }
 
+TEST(model, topological_sort_caching_add_cf_dangling_node) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto result = std::make_shared<ov::opset8::Result>(relu1);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // the dependency doesn't belong to the model, but becomes reachable from the result
+    auto dangling_relu = std::make_shared<ov::opset8::Relu>(arg0);
+    result->add_control_dependency(dangling_relu);
+
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, topological_sort_caching_remove_cf) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto result = std::make_shared<ov::opset8::Result>(relu1);
+    result->add_control_dependency(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+
+    result->remove_control_dependency(relu2);
+
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    result->add_control_dependency(relu2);
+    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+    result->clear_control_dependencies();
+
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(model, topological_sort_caching_get_ops) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(relu1);
+    auto result = std::make_shared<ov::opset8::Result>(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    const auto ordered_ops = f->get_ordered_ops();
+    auto ops = f->get_ops();
+    ASSERT_EQ(std::set<std::shared_ptr<ov::Node>>(ops.begin(), ops.end()),
+              std::set<std::shared_ptr<ov::Node>>(ordered_ops.begin(), ordered_ops.end()));
+
+    // the changed model is traversed without the sort
+    auto new_relu = std::make_shared<ov::opset8::Relu>(relu1);
+    ov::replace_node(relu2, new_relu);
+    ops = f->get_ops();
+    ASSERT_EQ(ops.size(), 4);
+    ASSERT_NE(std::find(ops.begin(), ops.end(), new_relu), ops.end());
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+}
+
+namespace {
+class NeverMatchingPass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("NeverMatchingPass");
+    NeverMatchingPass() {
+        auto pattern = ov::pass::pattern::wrap_type<ov::opset8::Sigmoid>();
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(pattern, "NeverMatchingPass"),
+                         [](ov::pass::pattern::Matcher&) {
+                             return false;
+                         });
+    }
+};
+}  // namespace
+
+// The pipelines run hundreds of passes over large models, so the passes which don't change the model
+// mustn't sort it again
+TEST(model, topological_sort_caching_large_model_pass_pipeline) {
+    const size_t num_nodes = 50000;
+    const size_t num_passes = 200;
+
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    std::shared_ptr<ov::Node> last = arg0;
+    for (size_t i = 0; i < num_nodes; i++) {
+        if (i % 2)
+            last = std::make_shared<ov::opset8::Add>(last, arg0);
+        else
+            last = std::make_shared<ov::opset8::Relu>(last);
+    }
+    auto result = std::make_shared<ov::opset8::Result>(last);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    size_t num_sorts = 0;
+    f->set_topological_sort([&num_sorts](const std::vector<std::shared_ptr<ov::Node>>& nodes) {
+        num_sorts++;
+        return ngraph::topological_sort(nodes);
+    });
+
+    ov::pass::Manager manager;
+    for (size_t i = 0; i < num_passes; i++)
+        manager.register_pass<NeverMatchingPass>();
+    manager.run_passes(f);
+
+    ASSERT_EQ(num_sorts, 1);
+    ASSERT_EQ(f->get_ordered_ops().size(), num_nodes + 2);
+    ASSERT_EQ(f->get_ops().size(), num_nodes + 2);
+    ASSERT_EQ(num_sorts, 1);
+
+    // the model is sorted again only after it's changed
+    auto new_relu = std::make_shared<ov::opset8::Relu>(last);
+    result->input(0).replace_source_output(new_relu);
+    manager.run_passes(f);
+    ASSERT_EQ(num_sorts, 2);
+    ASSERT_EQ(f->get_ordered_ops().size(), num_nodes + 3);
+}
+
 namespace bs_utils {
 static std::shared_ptr<ov::Model> create_n_inputs(ov::element::Type type,
                                                   const std::vector<ov::PartialShape>& shapes,
@@ -53,21 +53,25 @@ static std::string get_op_domain_and_name(const ONNX_NAMESPACE::NodeProto& node_
 }
 }  // namespace detail
 
-Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto, ov::frontend::ExtensionHolder extensions)
-    : Graph(model_proto, common::make_unique<GraphCache>(), std::move(extensions)) {}
+Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
+             ov::frontend::ExtensionHolder extensions,
+             bool mmap_enabled)
+    : Graph(model_proto, common::make_unique<GraphCache>(), std::move(extensions), mmap_enabled) {}
 
 Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
              std::unique_ptr<GraphCache>&& cache,
-             ov::frontend::ExtensionHolder extensions)
+             ov::frontend::ExtensionHolder extensions,
+             bool mmap_enabled)
     : m_model{common::make_unique<Model>(model_proto)},
       m_cache{std::move(cache)},
-      m_extensions{std::move(extensions)} {
+      m_extensions{std::move(extensions)},
+      m_mmap_enabled{mmap_enabled} {
     std::map<std::string, Tensor> initializers;
 
     // Process all initializers in the graph
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor};
+            Tensor tensor = Tensor{initializer_tensor, m_mmap_enabled};
             std::shared_ptr<default_opset::Constant> ng_constant;
             // For each initializer create a Constant node and store it in cache
             try {
@@ -332,7 +336,7 @@ const OpsetImports& Graph::get_opset_imports() const {
 }
 
 Subgraph::Subgraph(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto, const Graph* parent_graph)
-    : Graph(model_proto, common::make_unique<GraphCache>()),
+    : Graph(model_proto, common::make_unique<GraphCache>(), {}, parent_graph->is_mmap_enabled()),
       m_parent_graph(parent_graph) {
     // do not copy a pre-configured progress reporter extension to the subgraph, copy just the telemetry
     // (do not report subgraph conversion progress)
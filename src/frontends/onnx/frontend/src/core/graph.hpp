@@ -22,7 +22,8 @@ namespace onnx_import {
 class Graph : public std::enable_shared_from_this<Graph> {
 public:
     Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
-          ov::frontend::ExtensionHolder extensions = {});
+          ov::frontend::ExtensionHolder extensions = {},
+          bool mmap_enabled = false);
     Graph() = delete;
 
     Graph(const Graph&) = delete;
@@ -49,10 +50,15 @@ public:
         return m_extensions;
     }
 
+    bool is_mmap_enabled() const {
+        return m_mmap_enabled;
+    }
+
 protected:
     Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model,
           std::unique_ptr<GraphCache>&& cache,
-          ov::frontend::ExtensionHolder extensions = {});
+          ov::frontend::ExtensionHolder extensions = {},
+          bool mmap_enabled = false);
 
     void set_friendly_names(const Node& onnx_node, const OutputVector& ng_subgraph_outputs) const;
 
@@ -67,6 +73,7 @@ protected:
     std::unique_ptr<Model> m_model;
     std::unique_ptr<GraphCache> m_cache;
     ov::frontend::ExtensionHolder m_extensions = {};
+    bool m_mmap_enabled = false;
 
 private:
     std::vector<Node> m_nodes;
@@ -340,9 +340,10 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, bool mmap_enabled = false)
         : m_tensor_proto{&tensor},
-          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())} {
+          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
+          m_mmap_enabled{mmap_enabled} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -459,7 +460,21 @@ public:
 private:
     template <typename T>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
-        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        std::shared_ptr<ngraph::op::Constant> constant;
+        if (m_mmap_enabled && detail::has_tensor_external_data(*m_tensor_proto)) {
+            const auto external_data = detail::TensorExternalData(*m_tensor_proto);
+            // the constant points directly into the mapped file if the data is suitably aligned for the type,
+            // otherwise or if the file can't be mapped the data is copied
+            if (external_data.offset() % sizeof(T) == 0) {
+                auto buffer = external_data.load_external_mmap_data();
+                if (buffer && buffer->size() == shape_size(m_shape) * type.size()) {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                }
+            }
+        }
+        if (!constant) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
         }
@@ -468,6 +483,7 @@ private:
 
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
+    bool m_mmap_enabled;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
@@ -221,17 +221,23 @@ struct onnx_editor::ONNXModelEditor::Impl {
 #endif
 };
 
-onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::string& model_path, frontend::ExtensionHolder extensions)
+onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::string& model_path,
+                                              frontend::ExtensionHolder extensions,
+                                              bool enable_mmap)
     : m_model_path{model_path},
       m_extensions{std::move(extensions)},
+      m_enable_mmap{enable_mmap},
       m_pimpl{new ONNXModelEditor::Impl{model_path}, [](Impl* impl) {
                   delete impl;
               }} {}
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::wstring& model_path, frontend::ExtensionHolder extensions)
+onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::wstring& model_path,
+                                              frontend::ExtensionHolder extensions,
+                                              bool enable_mmap)
     : m_model_path{ngraph::file_util::wstring_to_string(model_path)},
       m_extensions{std::move(extensions)},
+      m_enable_mmap{enable_mmap},
       m_pimpl{new ONNXModelEditor::Impl{model_path}, [](Impl* impl) {
                   delete impl;
               }} {}
@@ -239,9 +245,11 @@ onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::wstring& model_path, fr
 
 onnx_editor::ONNXModelEditor::ONNXModelEditor(std::istream& model_stream,
                                               const std::string& model_path,
-                                              frontend::ExtensionHolder extensions)
+                                              frontend::ExtensionHolder extensions,
+                                              bool enable_mmap)
     : m_model_path{model_path},
       m_extensions{std::move(extensions)},
+      m_enable_mmap{enable_mmap},
       m_pimpl{new ONNXModelEditor::Impl{model_stream}, [](Impl* impl) {
                   delete impl;
               }} {}
@@ -434,7 +442,10 @@ std::string onnx_editor::ONNXModelEditor::model_string() const {
 }
 
 std::shared_ptr<Model> onnx_editor::ONNXModelEditor::get_function() const {
-    return ngraph::onnx_import::detail::import_onnx_model(m_pimpl->m_model_proto, m_model_path, m_extensions);
+    return ngraph::onnx_import::detail::import_onnx_model(m_pimpl->m_model_proto,
+                                                          m_model_path,
+                                                          m_extensions,
+                                                          m_enable_mmap);
 }
 
 void onnx_editor::ONNXModelEditor::set_input_values(
@@ -623,7 +634,10 @@ std::vector<std::string> onnx_editor::ONNXModelEditor::get_output_ports(const Ed
 }
 
 std::shared_ptr<Model> onnx_editor::ONNXModelEditor::decode() {
-    return ngraph::onnx_import::detail::decode_to_framework_nodes(m_pimpl->m_model_proto, m_model_path, m_extensions);
+    return ngraph::onnx_import::detail::decode_to_framework_nodes(m_pimpl->m_model_proto,
+                                                                  m_model_path,
+                                                                  m_extensions,
+                                                                  m_enable_mmap);
 }
 
 void onnx_editor::ONNXModelEditor::add_output(const OutputEdge& output_edge) const {
@@ -39,26 +39,28 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     if (variants.empty()) {
         return nullptr;
     }
+    // the last bool parameter enables the memory mapping of the external data files
+    const bool enable_mmap = variants.size() > 1 && variants.back().is<bool>() ? variants.back().as<bool>() : false;
     if (variants[0].is<std::string>()) {
         const auto path = variants[0].as<std::string>();
-        return std::make_shared<InputModel>(path, m_extensions);
+        return std::make_shared<InputModel>(path, m_extensions, enable_mmap);
     }
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     if (variants[0].is<std::wstring>()) {
         const auto path = variants[0].as<std::wstring>();
-        return std::make_shared<InputModel>(path, m_extensions);
+        return std::make_shared<InputModel>(path, m_extensions, enable_mmap);
     }
 #endif
     if (variants[0].is<std::istream*>()) {
         const auto stream = variants[0].as<std::istream*>();
         if (variants.size() > 1 && variants[1].is<std::string>()) {
             const auto path = variants[0].as<std::string>();
-            return std::make_shared<InputModel>(*stream, path, m_extensions);
+            return std::make_shared<InputModel>(*stream, path, m_extensions, enable_mmap);
         }
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
         if (variants.size() > 1 && variants[1].is<std::wstring>()) {
             const auto path = variants[1].as<std::wstring>();
-            return std::make_shared<InputModel>(*stream, path, m_extensions);
+            return std::make_shared<InputModel>(*stream, path, m_extensions, enable_mmap);
         }
 #endif
         return std::make_shared<InputModel>(*stream, m_extensions);
@@ -89,17 +89,19 @@ void convert_decoded_function(std::shared_ptr<Function> function) {
 
 std::shared_ptr<Function> import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
                                             const std::string& model_path,
-                                            ov::frontend::ExtensionHolder extensions) {
+                                            ov::frontend::ExtensionHolder extensions,
+                                            bool enable_mmap) {
     apply_transformations(*model_proto, model_path);
-    Graph graph{model_proto, extensions};
+    Graph graph{model_proto, extensions, enable_mmap};
     return graph.convert();
 }
 
 std::shared_ptr<Function> decode_to_framework_nodes(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
                                                     const std::string& model_path,
-                                                    ov::frontend::ExtensionHolder extensions) {
+                                                    ov::frontend::ExtensionHolder extensions,
+                                                    bool enable_mmap) {
     apply_transformations(*model_proto, model_path);
-    auto graph = std::make_shared<Graph>(model_proto, extensions);
+    auto graph = std::make_shared<Graph>(model_proto, extensions, enable_mmap);
     return graph->decode();
 }
 }  // namespace detail
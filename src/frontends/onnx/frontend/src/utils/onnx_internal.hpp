@@ -29,12 +29,14 @@ namespace detail {
 /// \param      model_path  The path to the imported onnx model.
 ///                         It is required if the imported model uses data saved in external files.
 /// \param      extensions An object containing a collection of frontend extensions to use during the import process
+/// \param      enable_mmap Whether the external data files are memory mapped instead of being read into memory
 ///
 /// \return     An nGraph function that represents a single output from the created
 /// graph.
 std::shared_ptr<Function> import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
                                             const std::string& model_path,
-                                            ov::frontend::ExtensionHolder extensions = {});
+                                            ov::frontend::ExtensionHolder extensions = {},
+                                            bool enable_mmap = false);
 
 /// \brief      Decode ONNX model to nGraph function with ONNXFrameworkNode(s)
 ///
@@ -42,11 +44,13 @@ std::shared_ptr<Function> import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::Mode
 /// \param      model_path  The path to the imported onnx model.
 ///                         It is required if the imported model uses data saved in external files.
 /// \param      extensions An object containing a collection of frontend extensions to use during the import process
+/// \param      enable_mmap Whether the external data files are memory mapped instead of being read into memory
 ///
 /// \return     A nGraph function with ONNXFrameworkNodes
 std::shared_ptr<Function> decode_to_framework_nodes(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
                                                     const std::string& model_path,
-                                                    ov::frontend::ExtensionHolder extensions = {});
+                                                    ov::frontend::ExtensionHolder extensions = {},
+                                                    bool enable_mmap = false);
 
 /// \brief     Converts a nGraph function (onnx model decoded to function with ONNXFrameworkNode(s))
 ///            to a complete function with actual compute operations
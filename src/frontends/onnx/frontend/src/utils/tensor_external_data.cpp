@@ -5,6 +5,8 @@
 #include "utils/tensor_external_data.hpp"
 
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -67,6 +69,61 @@ std::string TensorExternalData::load_external_data() const {
     return read_data;
 }
 
+Buffer<ov::util::MappedMemory> TensorExternalData::load_external_mmap_data() const {
+    NGRAPH_SUPPRESS_DEPRECATED_START
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    std::wstring path = ov::util::string_to_wstring(m_data_location);
+#else
+    std::string path = m_data_location;
+#endif
+    NGRAPH_SUPPRESS_DEPRECATED_END
+
+    // Usually all tensors of a model are stored in a single file, so the mapping is shared by them
+    static std::mutex mapped_files_mutex;
+    static std::map<decltype(path), std::weak_ptr<ov::util::MappedMemory>> mapped_files;
+
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    {
+        std::lock_guard<std::mutex> lock(mapped_files_mutex);
+        auto it = mapped_files.find(path);
+        if (it != mapped_files.end())
+            mapped_memory = it->second.lock();
+
+        if (!mapped_memory) {
+            try {
+                mapped_memory = ov::util::load_mmap_object(path);
+            } catch (const std::exception&) {
+                return nullptr;
+            }
+
+            for (auto expired = mapped_files.begin(); expired != mapped_files.end();) {
+                if (expired->second.expired())
+                    expired = mapped_files.erase(expired);
+                else
+                    ++expired;
+            }
+            mapped_files[path] = mapped_memory;
+        }
+    }
+
+    const size_t file_size = mapped_memory->size();
+    if (m_offset < 0 || static_cast<size_t>(m_offset) > file_size)
+        throw error::invalid_external_data{*this};
+
+    const size_t data_length = m_data_length == 0 ? file_size - m_offset : static_cast<size_t>(m_data_length);
+    if (m_offset + data_length > file_size)
+        throw error::invalid_external_data{*this};
+
+    if (m_sha1_digest != 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        mapped_memory->data() + m_offset,
+        data_length,
+        mapped_memory);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
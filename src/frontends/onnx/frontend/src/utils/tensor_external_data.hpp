@@ -6,9 +6,14 @@
 
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+template <class T>
+using Buffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<T>>>;
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +28,20 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data() const;
 
+    /// \brief      Map the external data file into memory and return the part of it which belongs to the tensor
+    ///
+    /// \note       The mapping of a file is shared by all tensors which refer to it while any of them is alive.
+    ///             If the tensor data is out of the file, the invalid_external_data exception is thrown.
+    ///
+    /// \return     Buffer pointing to the tensor data inside of the mapped file or nullptr if the file
+    ///             can't be mapped, the data has to be read by load_external_data then
+    Buffer<ov::util::MappedMemory> load_external_mmap_data() const;
+
+    /// \brief      Returns offset of the tensor data in the external file
+    int offset() const {
+        return m_offset;
+    }
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
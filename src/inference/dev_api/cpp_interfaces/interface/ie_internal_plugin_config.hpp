@@ -53,6 +53,40 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Allows the CPU plugin to execute independent branches of a graph concurrently within a single infer request
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief Makes the CPU plugin collect the latency histogram of every executed node per stream, implies PERF_COUNT.
+ *        The percentiles are reported by the NODE_LATENCY_PERCENTILES metric
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_HISTOGRAMS);
+
+/**
+ * @brief Makes the CPU plugin record the execution timeline of the infer requests and nodes per stream (YES/NO),
+ *        the timeline is exported with CPU_TRACE_FILE
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_TRACE);
+
+/**
+ * @brief Passed to ExecutableNetwork::SetConfig, exports the timeline recorded with CPU_TRACE to the file
+ *        with the given path in the Chrome trace format
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_TRACE_FILE);
+
+/**
+ * @brief Directory of the storage where the CPU plugin keeps reordered constant data shared between processes,
+ *        empty value disables the storage
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_WEIGHTS_DIR);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
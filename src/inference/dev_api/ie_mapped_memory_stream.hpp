@@ -0,0 +1,59 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Input stream over memory mapped data
+ * @file ie_mapped_memory_stream.hpp
+ */
+
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <streambuf>
+
+#include "ie_api.h"
+#include "openvino/util/mmap_object.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Input stream which reads a memory mapped cache entry
+ * @ingroup ie_dev_api_plugin_api
+ *
+ * Plugins receive this stream in IInferencePlugin::ImportNetwork when a compiled network is imported from
+ * a mapped cache file. A plugin can detect it with dynamic_cast and reference the mapped data directly
+ * instead of copying it out of the stream. Stream positions are offsets in the mapped memory.
+ */
+class INFERENCE_ENGINE_API_CLASS(MappedMemoryStream) : public std::istream {
+public:
+    /**
+     * @brief Creates a stream over the whole mapped memory
+     * @param memory Mapped memory, the stream keeps it alive
+     */
+    explicit MappedMemoryStream(std::shared_ptr<ov::util::MappedMemory> memory);
+
+    ~MappedMemoryStream() override;
+
+    /**
+     * @brief Returns the mapped memory the stream reads
+     * @return Mapped memory object
+     */
+    const std::shared_ptr<ov::util::MappedMemory>& getMemory() const noexcept;
+
+private:
+    class MappedBuffer : public std::streambuf {
+    public:
+        MappedBuffer(char* data, size_t size);
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+    };
+
+    std::shared_ptr<ov::util::MappedMemory> _memory;
+    MappedBuffer _buffer;
+};
+
+}  // namespace InferenceEngine
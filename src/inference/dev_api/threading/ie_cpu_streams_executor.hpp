@@ -20,7 +20,8 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from the per stream lock-free queues,
+ *        the idle threads steal tasks from the other streams of the same NUMA node first.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -34,5 +34,36 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the pipelined execution of the subnetworks: the subnetwork requests are shared by
+ * all the infer requests of the executable network and taken only for the time of the subnetwork execution, so the
+ * subnetwork k of one request is executed concurrently with the subnetwork k+1 of the previous one.
+ * To split the network between several instances of the same device (e.g. CPU pinned to the different NUMA nodes),
+ * register the device plugin under several names and set the affinities of the nodes to these names.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE);
+
+/**
+ * @brief The key for selecting the cost model driven assignment of the layers to the devices instead of the devices
+ * priority. The layers are split into the contiguous parts of the topological order taking into account the layer
+ * costs on every device and the cost of the data transfer between the devices.
+ * This option should be used with values: empty string (default, the priority of the devices is used),
+ * CONFIG_VALUE(LATENCY) to minimize the inference latency or CONFIG_VALUE(THROUGHPUT) to minimize the slowest stage
+ * of the pipeline (see HETERO_PIPELINE). The layers with the affinity set by the user are pinned to these devices
+ * (which have to be listed in the devices priority) and the cost model assigns the rest of the layers.
+ * The chosen partition with the predicted costs is dumped as hetero_partition_<network name>.dot if
+ * HETERO_DUMP_GRAPH_DOT is enabled.
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITIONING);
+
+/**
+ * @brief The key for the path to the layer costs used by HETERO_PARTITIONING. The text file has the lines
+ * "<device> <layer name> <microseconds>" (e.g. taken from the performance counters of a profiling run on the device)
+ * and the optional line "transfer <microseconds per megabyte>" with the cost of the data transfer between the devices.
+ * The layers missed in the file are considered to be free.
+ */
+DECLARE_HETERO_CONFIG_KEY(NODE_COSTS);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -229,6 +229,35 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a histogram of the batch sizes executed by the auto-batching executable network:
+ * std::map with the number of the executed inferences per batch size.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_HISTOGRAM, std::map<unsigned int, uint64_t>);
+
+/**
+ * @brief Metric to get the memory used by the dynamic shape tensors of the executable network:
+ * std::map with the peak memory size in bytes per input shapes bucket. The bucket is named by the input
+ * dimensions rounded up to a power of two, e.g. "1x4x256x256,1x16" for the network with two inputs.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(SHAPE_BUCKETS_PEAK_MEMORY, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the latency percentiles of the executed nodes of the executable network collected over all the
+ * streams: std::map with the {p50, p90, p99, max} latencies in microseconds per node name. The values are the upper
+ * bounds of the log-scale histogram buckets, so the relative error is below 12.5%. Available only if the histograms
+ * collection is enabled in the device configuration.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NODE_LATENCY_PERCENTILES, std::map<std::string, std::vector<double>>);
+
+/**
+ * @brief Metric to get the NUMA placement of the memory used by the streams of the executable network: std::map with
+ * the {NUMA node, local bytes, remote bytes} per stream index. The bytes are the resident pages of the tensors of the
+ * stream classified by whether they are placed on the NUMA node of the stream, so the remote bytes estimate the
+ * memory the stream accesses over the socket interconnect. The streams with the unknown NUMA node are not reported.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NUMA_MEMORY_PLACEMENT, std::map<std::string, std::vector<uint64_t>>);
+
 }  // namespace Metrics
 
 /**
@@ -293,6 +322,13 @@ DECLARE_CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG);
  * @brief Auto-batching configuration: string with timeout (in ms), e.g. "100"
  */
 DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+/**
+ * @brief Auto-batching configuration: enables the adaptive batch collection, "YES" or "NO" (default).
+ * The time to wait for the batch is deduced from the requests arrival rate and the measured batched inference latency
+ * (the AUTO_BATCH_TIMEOUT is the upper bound), while the partially collected batches are executed with the
+ * additionally compiled lower-batch variants of the network.
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_ADAPTIVE);
 
 /**
  * @brief Limit `#threads` that are used by Inference Engine for inference on the CPU.
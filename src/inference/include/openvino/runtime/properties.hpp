@@ -433,6 +433,23 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief This property defines whether the weights of models read from files are memory mapped
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * Constants of the read model point directly into the mapped weights file, so the file is not read into memory
+ * in full and its pages are shared between all processes that read the same model.
+ * The property is applied to the weights of OpenVINO IR and to the external data files of ONNX models and is disabled
+ * by default. The ONNX tensors which can't be mapped are read into memory.
+ * Compiled models imported from ov::cache_dir are mapped as well, so plugins supporting it bind
+ * their weights to the cache file instead of reading them.
+ *
+ * @code
+ * core.set_property(ov::enable_mmap(true));
+ * @endcode
+ */
+static constexpr Property<bool> enable_mmap{"ENABLE_MMAP"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  *
@@ -12,12 +12,20 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/variable.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
@@ -41,6 +49,255 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+namespace {
+
+template <typename T>
+std::string toString(const T& value) {
+    std::stringstream strm;
+    strm << value;
+    return strm.str();
+}
+
+bool hashModel(uint64_t& seed, const ov::Model& model);
+
+/**
+ * @brief Hashes node attributes without building textual IR representation.
+ * Constant data is not visited, the memoized Constant::get_data_hash() is used instead.
+ * If an attribute of unknown type is met, the visitor is marked as unsupported
+ */
+class AttributesHasher : public ov::AttributeVisitor {
+public:
+    explicit AttributesHasher(uint64_t& seed) : m_seed(seed) {}
+
+    bool isSupported() const {
+        return m_supported;
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        using InputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::InputDescription>>;
+        using OutputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::OutputDescription>>;
+
+        m_seed = hash_combine(m_seed, name);
+        if (ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            // Constant data is accounted by the model walker
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get()->get_info().variable_id);
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            m_seed = hash_combine(m_seed, toString(a->get()));
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            m_seed = hash_combine(m_seed, toString(a->get()));
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get())
+                m_seed = hash_combine(m_seed, type.get_type_name());
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<InputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_input_index);
+                m_seed = hash_combine(m_seed, desc->m_body_parameter_index);
+                if (auto slice = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::SliceInputDescription>(desc)) {
+                    for (auto v : {slice->m_start, slice->m_stride, slice->m_part_size, slice->m_end, slice->m_axis})
+                        m_seed = hash_combine(m_seed, v);
+                } else if (auto merged =
+                               ov::as_type_ptr<ov::op::util::MultiSubGraphOp::MergedInputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, merged->m_body_value_index);
+                }
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_body_value_index);
+                m_seed = hash_combine(m_seed, desc->m_output_index);
+                if (auto concat = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::ConcatOutputDescription>(desc)) {
+                    for (auto v :
+                         {concat->m_start, concat->m_stride, concat->m_part_size, concat->m_end, concat->m_axis})
+                        m_seed = hash_combine(m_seed, v);
+                } else if (auto body = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::BodyOutputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, body->m_iteration);
+                }
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().current_iteration_input_idx);
+            m_seed = hash_combine(m_seed, a->get().body_condition_output_idx);
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            m_seed = hash_combine(m_seed, attrs.get_type_name());
+            m_seed = hash_combine(m_seed, attrs.get_opset_name());
+            for (const auto& attr : attrs) {
+                m_seed = hash_combine(m_seed, attr.first);
+                m_seed = hash_combine(m_seed, attr.second);
+            }
+        } else {
+            m_supported = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        if (!hashModel(m_seed, *adapter.get()))
+            m_supported = false;
+    }
+
+private:
+    template <typename T>
+    void hashValue(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void hashVector(const std::string& name, const std::vector<T>& values) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, values.size());
+        for (const auto& value : values)
+            m_seed = hash_combine(m_seed, value);
+    }
+
+    uint64_t& m_seed;
+    bool m_supported = true;
+};
+
+uint64_t hashRtInfo(uint64_t seed, const ov::RTMap& rt) {
+    for (const auto& rtMapData : rt) {
+        seed = hash_combine(seed, rtMapData.first);
+        std::stringstream strm;
+        rtMapData.second.print(strm);
+        seed = hash_combine(seed, strm.str());
+    }
+    return seed;
+}
+
+/**
+ * @brief Calculates hash of the model structure: operations, attributes, connections,
+ * port types, tensor names and port runtime information. Constants contribute their memoized data hash.
+ * Names are taken into account only if they were set explicitly, like in deterministic serialization.
+ * @return false if the model contains attributes which can't be hashed
+ */
+bool hashModel(uint64_t& seed, const ov::Model& model) {
+    if (model.get_friendly_name() != model.get_name())
+        seed = hash_combine(seed, model.get_friendly_name());
+
+    std::unordered_map<const ov::Node*, size_t> ids;
+    for (const auto& op : model.get_ordered_ops()) {
+        const auto id = ids.size();
+        ids[op.get()] = id;
+
+        const auto& typeInfo = op->get_type_info();
+        seed = hash_combine(seed, std::string(typeInfo.name));
+        seed = hash_combine(seed, typeInfo.get_version());
+        if (op->get_friendly_name() != op->get_name())
+            seed = hash_combine(seed, op->get_friendly_name());
+
+        for (const auto& input : op->inputs()) {
+            const auto source = input.get_source_output();
+            seed = hash_combine(seed, ids.at(source.get_node()));
+            seed = hash_combine(seed, source.get_index());
+            seed = hashRtInfo(seed, input.get_rt_info());
+        }
+        for (const auto& output : op->outputs()) {
+            seed = hash_combine(seed, output.get_element_type().get_type_name());
+            seed = hash_combine(seed, toString(output.get_partial_shape()));
+            const auto& names = output.get_names();
+            std::vector<std::string> sortedNames(names.begin(), names.end());
+            std::sort(sortedNames.begin(), sortedNames.end());
+            for (const auto& name : sortedNames)
+                seed = hash_combine(seed, name);
+            seed = hashRtInfo(seed, output.get_rt_info());
+        }
+
+        // The type and the shape of the constant are hashed with its output. The constant attributes are not
+        // visited, since visit_attributes resets the memoized data hash.
+        if (auto constant = ov::as_type<ov::op::v0::Constant>(op.get())) {
+            seed = hash_combine(seed, constant->get_data_hash());
+            continue;
+        }
+
+        AttributesHasher visitor(seed);
+        if (!op->visit_attributes(visitor) || !visitor.isSupported())
+            return false;
+    }
+
+    // Order of parameters, results and sinks is a part of the model signature
+    for (const auto& param : model.get_parameters())
+        seed = hash_combine(seed, ids.at(param.get()));
+    for (const auto& result : model.get_results())
+        seed = hash_combine(seed, ids.at(result.get()));
+    for (const auto& sink : model.get_sinks())
+        seed = hash_combine(seed, ids.at(sink.get()));
+    return true;
+}
+
+}  // namespace
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -74,8 +331,18 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     CNNNetwork net(network);
     ov::pass::Manager m;
     m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
     m.run_passes(net.getFunction());
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - Model");
+        if (!hashModel(seed, *net.getFunction())) {
+            // Some attributes are not known to the structural hashing, fall back to hash of serialized model
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - Serialize");
+            seed = 0;
+            ov::pass::Manager hashManager;
+            hashManager.register_pass<ov::pass::Hash>(seed);
+            hashManager.run_passes(net.getFunction());
+        }
+    }
 
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
@@ -84,13 +351,7 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
 
     // 3. Add runtime information which may not be serialized
     for (const auto& op : network.getFunction()->get_ordered_ops()) {
-        const auto& rt = op->get_rt_info();
-        for (const auto& rtMapData : rt) {
-            seed = hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
-            rtMapData.second.print(strm);
-            seed = hash_combine(seed, strm.str());
-        }
+        seed = hashRtInfo(seed, op->get_rt_info());
     }
 
     // 4. Add inputs info
@@ -16,6 +16,7 @@
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "openvino/util/mmap_object.hpp"
 
 namespace InferenceEngine {
 
@@ -62,6 +63,25 @@ public:
      */
     virtual void readCacheEntry(const std::string& id, StreamReader reader) = 0;
 
+    /**
+     * @brief Function passing memory mapped cache entry
+     *
+     */
+    using MappedReader = std::function<void(const std::shared_ptr<ov::util::MappedMemory>&)>;
+    /**
+     * @brief Callback when Inference Engine intends to read network from cache without copying it
+     *
+     * Client maps the cache entry into memory and calls reader(memory). The mapping may be referenced
+     * by the imported network after the reader returns, so the entry must not be modified in place.
+     *
+     * @param id Id of cache (hash of the network)
+     * @param reader Lambda function to be called when the entry is mapped
+     * @return `false` if the entry can't be mapped, so readCacheEntry should be used instead
+     */
+    virtual bool readMappedCacheEntry(const std::string& id, MappedReader reader) {
+        return false;
+    }
+
     /**
      * @brief Callback when Inference Engine intends to remove cache entry
      *
@@ -100,7 +120,10 @@ public:
 
 private:
     void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
+        // The old file may be mapped by imported networks, so it is unlinked instead of being truncated
+        auto blobFileName = getBlobFile(id);
+        std::remove(blobFileName.c_str());
+        std::ofstream stream(blobFileName, std::ios_base::binary | std::ofstream::out);
         writer(stream);
     }
 
@@ -112,6 +135,21 @@ private:
         }
     }
 
+    bool readMappedCacheEntry(const std::string& id, MappedReader reader) override {
+        auto blobFileName = getBlobFile(id);
+        if (!FileUtils::fileExist(blobFileName))
+            return false;
+
+        std::shared_ptr<ov::util::MappedMemory> memory;
+        try {
+            memory = ov::util::load_mmap_object(blobFileName);
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+        reader(memory);
+        return true;
+    }
+
     void removeCacheEntry(const std::string& id) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName))
@@ -6,6 +6,7 @@
 
 #include <sys/stat.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -23,6 +24,7 @@
 #include "file_utils.h"
 #include "ie_cache_guard.hpp"
 #include "ie_cache_manager.hpp"
+#include "ie_mapped_memory_stream.hpp"
 #include "ie_icore.hpp"
 #include "ie_itt.hpp"
 #include "ie_network_reader.hpp"
@@ -160,6 +162,16 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
                 config.erase(it);
             }
+
+            it = config.find(ov::enable_mmap.name());
+            if (it != config.end()) {
+                _enableMmap = Any(it->second).as<bool>();
+                config.erase(it);
+            }
+        }
+
+        bool getEnableMmap() const {
+            return _enableMmap;
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -171,6 +183,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic_bool _enableMmap{false};
     };
 
     // Core settings (cache config, etc)
@@ -285,7 +298,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
         OPENVINO_ASSERT(cacheManager != nullptr);
         try {
-            cacheManager->readCacheEntry(blobId, [&](std::istream& networkStream) {
+            auto importFromStream = [&](std::istream& networkStream) {
                 OV_ITT_SCOPE(FIRST_INFERENCE,
                              ie::itt::domains::IE_LT,
                              "Core::LoadNetworkFromCache::ReadStreamAndImport");
@@ -307,7 +320,19 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 execNetwork = context ? plugin.import_model(networkStream, context, config)
                                       : plugin.import_model(networkStream, config);
                 networkIsImported = true;
-            });
+            };
+
+            // Mapped entry lets plugins reference the compiled blob data instead of reading it
+            bool isMapped = coreConfig.getEnableMmap() &&
+                            cacheManager->readMappedCacheEntry(
+                                blobId,
+                                [&](const std::shared_ptr<ov::util::MappedMemory>& memory) {
+                                    ie::MappedMemoryStream networkStream(memory);
+                                    importFromStream(networkStream);
+                                });
+            if (!isMapped) {
+                cacheManager->readCacheEntry(blobId, importFromStream);
+            }
         } catch (const HeaderException&) {
             // For these exceptions just remove old cache and set that import didn't work
             cacheManager->removeCacheEntry(blobId);
@@ -480,7 +505,12 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
-        return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        return InferenceEngine::details::ReadNetwork(modelPath,
+                                                     binPath,
+                                                     extensions,
+                                                     ov_extensions,
+                                                     newAPI,
+                                                     coreConfig.getEnableMmap());
     }
 
     ie::CNNNetwork ReadNetwork(const std::string& model, const ie::Blob::CPtr& weights) const override {
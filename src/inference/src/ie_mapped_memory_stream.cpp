@@ -0,0 +1,51 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mapped_memory_stream.hpp"
+
+namespace InferenceEngine {
+
+MappedMemoryStream::MappedBuffer::MappedBuffer(char* data, size_t size) {
+    setg(data, data, data + size);
+}
+
+MappedMemoryStream::MappedBuffer::pos_type MappedMemoryStream::MappedBuffer::seekoff(off_type off,
+                                                                                     std::ios_base::seekdir dir,
+                                                                                     std::ios_base::openmode which) {
+    if (!(which & std::ios_base::in))
+        return pos_type(off_type(-1));
+
+    off_type base = 0;
+    if (dir == std::ios_base::cur) {
+        base = gptr() - eback();
+    } else if (dir == std::ios_base::end) {
+        base = egptr() - eback();
+    }
+    const off_type pos = base + off;
+    if (pos < 0 || pos > egptr() - eback())
+        return pos_type(off_type(-1));
+
+    setg(eback(), eback() + pos, egptr());
+    return pos_type(pos);
+}
+
+MappedMemoryStream::MappedBuffer::pos_type MappedMemoryStream::MappedBuffer::seekpos(pos_type pos,
+                                                                                     std::ios_base::openmode which) {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+MappedMemoryStream::MappedMemoryStream(std::shared_ptr<ov::util::MappedMemory> memory)
+    : std::istream(nullptr),
+      _memory(std::move(memory)),
+      _buffer(_memory->data(), _memory->size()) {
+    rdbuf(&_buffer);
+}
+
+MappedMemoryStream::~MappedMemoryStream() = default;
+
+const std::shared_ptr<ov::util::MappedMemory>& MappedMemoryStream::getMemory() const noexcept {
+    return _memory;
+}
+
+}  // namespace InferenceEngine
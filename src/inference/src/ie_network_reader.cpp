@@ -459,7 +459,8 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
                                 const std::string& binPath,
                                 const std::vector<IExtensionPtr>& exts,
                                 const std::vector<ov::Extension::Ptr>& ov_exts,
-                                bool newAPI) {
+                                bool newAPI,
+                                bool enableMmap) {
 #ifdef ENABLE_IR_V7_READER
     // IR v7 obsolete code
     {
@@ -504,6 +505,9 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
         FE->add_extension(ov_exts);
         if (!exts.empty())
             FE->add_extension(wrap_old_extensions(exts));
+        // only the IR and ONNX frontends take the mmap flag, the others reject the unknown parameters
+        if (enableMmap && (FE->get_name() == "ir" || FE->get_name() == "onnx"))
+            params.emplace_back(enableMmap);
         inputModel = FE->load(params);
     }
 
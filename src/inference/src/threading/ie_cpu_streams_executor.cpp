@@ -4,10 +4,12 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -25,7 +27,87 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue of tasks (the ring of cells with sequence numbers).
+ * Producers are the threads calling CPUStreamsExecutor::run, consumers are the owning stream thread
+ * and the threads stealing the tasks.
+ */
+class BoundedTaskQueue {
+public:
+    explicit BoundedTaskQueue(const std::size_t capacity) : _cells{new Cell[capacity]}, _mask{capacity - 1} {
+        assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // the queue is full
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_task = std::move(task);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // the queue is empty
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        task = std::move(cell->_task);
+        cell->_task = {};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr std::size_t cacheLineSize = 64;
+    struct Cell {
+        std::atomic<std::size_t> _sequence;
+        Task _task;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    const std::size_t _mask;
+    // the producers and the consumers positions are kept in the different cache lines
+    char _padding0[cacheLineSize];
+    std::atomic<std::size_t> _enqueuePos = {0};
+    char _padding1[cacheLineSize];
+    std::atomic<std::size_t> _dequeuePos = {0};
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    // number of tasks every stream thread can hold in the lock-free queue, the rest goes to the overflow queue
+    static constexpr std::size_t streamQueueCapacity = 1024;
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -67,11 +149,7 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_config._streams
-                              ? _impl->_usedNumaNodes.at((_streamId % _impl->_config._streams) /
-                                                         ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1) /
-                                                          _impl->_usedNumaNodes.size()))
-                              : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            _numaNodeId = _impl->GetNumaNodeId(_streamId);
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             const auto concurrency = (0 == _impl->_config._threadsPerStream) ? custom::task_arena::automatic
                                                                              : _impl->_config._threadsPerStream;
@@ -215,20 +293,35 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new BoundedTaskQueue{streamQueueCapacity});
+        }
+        // the stream threads try to steal the tasks from the streams on the same NUMA node first
+        _stealingOrder.resize(_config._streams);
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            auto& order = _stealingOrder[streamId];
+            for (auto i = 1; i < _config._streams; ++i) {
+                order.push_back((streamId + i) % _config._streams);
+            }
+            std::stable_partition(order.begin(), order.end(), [&](int victim) {
+                return GetNumaNodeId(victim) == GetNumaNodeId(streamId);
+            });
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
+                    if (!TryGetTask(streamId, task)) {
                         std::unique_lock<std::mutex> lock(_mutex);
+                        _sleepingThreads.fetch_add(1);
+                        // pairs with the fence in Enqueue: either the task pushed is seen here
+                        // or the producer sees the sleeping thread and notifies it
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return TryGetTask(streamId, task) || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                        _sleepingThreads.fetch_sub(1);
                     }
                     if (task) {
                         Execute(task, *(_streams.local()));
@@ -238,12 +331,49 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    int GetNumaNodeId(const int streamId) const {
+        return _config._streams
+                   ? _usedNumaNodes.at((streamId % _config._streams) /
+                                       ((_config._streams + _usedNumaNodes.size() - 1) / _usedNumaNodes.size()))
+                   : _usedNumaNodes.at(streamId % _usedNumaNodes.size());
+    }
+
+    bool TryGetTask(const int streamId, Task& task) {
+        if (_taskQueues[streamId]->TryPop(task)) {
+            return true;
+        }
+        // the overflow tasks are older than the ones in the other stream queues, so they are taken before stealing
+        if (_overflowSize.load(std::memory_order_acquire) != 0) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _overflowSize.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+        }
+        for (auto victim : _stealingOrder[streamId]) {
+            if (_taskQueues[victim]->TryPop(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
+        const auto streamId = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _taskQueues.size();
+        // while the overflow queue is not drained the new tasks are put behind it to keep the FIFO order
+        if (_overflowSize.load(std::memory_order_acquire) != 0 || !_taskQueues[streamId]->TryPush(task)) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
             _taskQueue.emplace(std::move(task));
+            _overflowSize.fetch_add(1, std::memory_order_release);
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_sleepingThreads.load(std::memory_order_relaxed) != 0) {
+            // the lock guarantees the sleeping thread is already waiting on the condition variable
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -280,9 +410,18 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    // per stream lock-free queues and the order of the queues to steal the tasks from
+    std::vector<std::unique_ptr<BoundedTaskQueue>> _taskQueues;
+    std::vector<std::vector<int>> _stealingOrder;
+    std::atomic<std::size_t> _nextQueue = {0};
+    // the mutex and the condition variable are used to put the idle stream threads to sleep only
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
+    std::atomic<int> _sleepingThreads = {0};
+    // the tasks which did not fit into the stream queue
+    std::mutex _overflowMutex;
     std::queue<Task> _taskQueue;
+    std::atomic<std::size_t> _overflowSize = {0};
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
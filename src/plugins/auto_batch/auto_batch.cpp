@@ -5,6 +5,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <algorithm>
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -27,7 +29,9 @@
 namespace AutoBatchPlugin {
 using namespace InferenceEngine;
 
-std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CONFIG_KEY(AUTO_BATCH_TIMEOUT)};
+std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
+                                                 CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                                                 CONFIG_KEY(AUTO_BATCH_ADAPTIVE)};
 
 template <Precision::ePrecision precision>
 Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
@@ -196,6 +200,7 @@ void AutoBatchInferRequest::ShareBlobsWithBatchRequest(const std::set<std::strin
             IE_THROW() << "Unsupported input precision " << it.second->getTensorDesc().getPrecision();
         }
         _inputs[it.first] = res;
+        _sharedBlobsDescs[it.first] = res->getTensorDesc();
     }
     // Allocate all output blobs
     for (const auto& it : _networkOutputs) {
@@ -310,15 +315,41 @@ void AutoBatchInferRequest::ShareBlobsWithBatchRequest(const std::set<std::strin
             IE_THROW(NotImplemented) << "Unsupported input precision " << it.second->getTensorDesc().getPrecision();
         }
         _outputs[it.first] = res;
+        _sharedBlobsDescs[it.first] = res->getTensorDesc();
     }
 }
+void AutoBatchInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& userBlob) {
+    IInferRequestInternal::SetBlob(name, userBlob);
+    // the blob set without pre-processing replaces the one set with it, so the stale pre-processing data is dropped
+    // (otherwise it would be still returned by GetBlob and handed over to the batch1 request)
+    const auto input = _inputs.find(name);
+    if (input != _inputs.end() && input->second == userBlob)
+        _preProcData.erase(name);
+    const auto sharedDesc = _sharedBlobsDescs.find(name);
+    const bool batchable = _preProcData.find(name) == _preProcData.end() && userBlob->is<MemoryBlob>() &&
+                           !userBlob->is<RemoteBlob>() && sharedDesc != _sharedBlobsDescs.end() &&
+                           userBlob->getTensorDesc() == sharedDesc->second;
+    if (batchable)
+        _notBatchableBlobs.erase(name);
+    else
+        _notBatchableBlobs.insert(name);
+}
+
 void AutoBatchInferRequest::SetBlobsToAnotherRequest(SoIInferRequestInternal& req) {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
         auto blob = GetBlob(name);
-        if (req->GetBlob(name) != blob)
+        // the pre-processing is executed by the other request, its pre-processing set for the previous
+        // execution is reset as well, so it is not reused for the blobs which need none
+        const auto& otherPreProcess = req->GetPreProcess(name);
+        const bool otherHasPreProcess = otherPreProcess.getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE ||
+                                        otherPreProcess.getColorFormat() != ColorFormat::RAW;
+        if (_preProcData.count(name) || otherHasPreProcess) {
+            req->SetBlob(name, blob, GetPreProcess(name));
+        } else if (req->GetBlob(name) != blob) {
             req->SetBlob(name, blob);
+        }
     }
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
@@ -333,13 +364,27 @@ void AutoBatchInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name),
+                         _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         true,
+                         _batchId,
+                         _batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToRequest(SoIInferRequestInternal& req, size_t batchId, size_t batchSize) {
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, batchId, batchSize);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -347,13 +392,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -365,7 +410,19 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         GetBlob(name),
+                         false,
+                         _batchId,
+                         _batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromRequest(SoIInferRequestInternal& req, size_t batchId, size_t batchSize) {
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, batchId, batchSize);
     }
 }
 
@@ -380,6 +437,19 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
     struct ThisRequestExecutor : public ITaskExecutor {
         explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
         void run(Task task) override {
+            if (!_this->_inferRequest->IsBatchable()) {
+                // the user blobs can not be shared with (or copied to) the batched request, so executing as is
+                auto& inferRequest = _this->_inferRequest;
+                inferRequest->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                inferRequest->SetBlobsToAnotherRequest(_this->_inferRequestWithoutBatch);
+                _this->_inferRequestWithoutBatch->SetCallback([inferRequest, task](std::exception_ptr p) {
+                    if (p)
+                        inferRequest->_exceptionPtr = p;
+                    task();
+                });
+                _this->_inferRequestWithoutBatch->StartAsync();
+                return;
+            }
             auto& workerInferRequest = _this->_inferRequest->_myBatchedRequestWrapper;
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
@@ -387,7 +457,8 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = workerInferRequest._tasks.size();
-            if (sz == workerInferRequest._batchSize) {
+            // the adaptive policy re-evaluates the time to wait for the batch on every arrival
+            if (sz == workerInferRequest._batchSize || workerInferRequest._adaptive) {
                 workerInferRequest._cond.notify_one();
             }
         };
@@ -411,6 +482,8 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::LOWER_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->_lowerBatchRequest->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -423,10 +496,64 @@ AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
     StopAndWait();
 }
 
+// ------------------------------BatchStatistics----------------------------
+namespace {
+// weight of the new sample in the moving averages
+constexpr double movingAverageFactor = 0.2;
+
+void UpdateMovingAverage(double& average, double sample) {
+    average = average ? average + movingAverageFactor * (sample - average) : sample;
+}
+}  // namespace
+
+void BatchStatistics::RecordArrivals(int num, Clock::time_point time, Clock::duration timeout) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_lastArrival != Clock::time_point{}) {
+        // the idle periods longer than the timeout do not tell anything about the batch collection
+        const auto interval = std::min<Clock::duration>(time - _lastArrival, timeout);
+        UpdateMovingAverage(_arrivalInterval,
+                            std::chrono::duration<double, std::micro>(interval).count() / std::max(num, 1));
+    }
+    _lastArrival = time;
+}
+
+void BatchStatistics::RecordExecution(int batchSize, Clock::duration latency) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    UpdateMovingAverage(_latency[batchSize], std::chrono::duration<double, std::micro>(latency).count());
+    _histogram[batchSize]++;
+}
+
+BatchStatistics::Clock::duration BatchStatistics::GetWaitTime(int collected,
+                                                               int batchSize,
+                                                               Clock::duration timeout) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_arrivalInterval == 0.)  // nothing is known about the arrivals yet
+        return timeout;
+    // waiting for the batch should not take longer than the batched inference itself,
+    // when the full batch was not executed yet, the latency is extrapolated from the largest executed batch
+    std::chrono::duration<double, std::micro> budget = timeout;
+    if (!_latency.empty()) {
+        const auto& largest = *_latency.rbegin();
+        budget = std::min(budget,
+                          std::chrono::duration<double, std::micro>(largest.second * batchSize / largest.first));
+    }
+    const auto expected = std::chrono::duration<double, std::micro>(_arrivalInterval * (batchSize - collected));
+    if (expected > budget)  // the batch is unlikely to be collected in time, so no reason to wait at all
+        return Clock::duration::zero();
+    // leaving some slack for the bursty arrivals
+    return std::chrono::duration_cast<Clock::duration>(std::min(budget, 2 * expected));
+}
+
+std::map<unsigned int, uint64_t> BatchStatistics::GetHistogram() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _histogram;
+}
+
 // ------------------------------AutoBatchExecutableNetwork----------------------------
 AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const InferenceEngine::SoExecutableNetworkInternal& networkWithBatch,
     const InferenceEngine::SoExecutableNetworkInternal& networkWithoutBatch,
+    const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksLowerBatch,
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
@@ -435,6 +562,7 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _networksLowerBatch{networksLowerBatch},
       _config{config},
       _batchedInputs(batchedInputs),
       _batchedOutputs(batchedOutputs) {
@@ -443,6 +571,8 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
     _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    auto adaptive = config.find(CONFIG_KEY(AUTO_BATCH_ADAPTIVE));
+    _adaptive = adaptive != config.end() && adaptive->second.as<std::string>() == CONFIG_VALUE(YES);
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
@@ -503,13 +633,20 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
         _workerRequests.push_back(std::make_shared<WorkerInferRequest>());
         auto workerRequestPtr = _workerRequests.back().get();
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
+        for (const auto& lower : _networksLowerBatch)
+            workerRequestPtr->_inferRequestsLowerBatch[lower.first] = {lower.second->CreateInferRequest(),
+                                                                       lower.second._so};
         workerRequestPtr->_batchSize = _device.batchForDevice;
+        workerRequestPtr->_adaptive = _adaptive;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
+                workerRequestPtr->_statistics.RecordExecution(
+                    workerRequestPtr->_batchSize,
+                    BatchStatistics::Clock::now() - workerRequestPtr->_startTime);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
                     workerRequestPtr->_completionTasks[c]();
@@ -519,18 +656,41 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            using Clock = BatchStatistics::Clock;
+            Clock::duration waitTime = std::chrono::milliseconds(_timeOut);
+            // number of the tasks in the queue at the previous wake up and the arrival of the first one
+            int observed = 0;
+            Clock::time_point collectionStart;
             while (1) {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    status = workerRequestPtr->_cond.wait_for(lock, waitTime);
                 }
                 if (_terminate) {
                     break;
                 } else {
+                    const Clock::duration timeout = std::chrono::milliseconds(_timeOut);
+                    waitTime = timeout;
                     // as we pop the tasks from the queue only here
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = workerRequestPtr->_tasks.size();
+                    bool executePartialBatch = (status == std::cv_status::timeout);
+                    if (workerRequestPtr->_adaptive && sz && sz < workerRequestPtr->_batchSize) {
+                        const auto now = Clock::now();
+                        if (sz > observed) {
+                            workerRequestPtr->_statistics.RecordArrivals(sz - observed, now, timeout);
+                            if (!observed)
+                                collectionStart = now;
+                            observed = sz;
+                        }
+                        const auto remaining =
+                            workerRequestPtr->_statistics.GetWaitTime(sz, workerRequestPtr->_batchSize, timeout) -
+                            (now - collectionStart);
+                        executePartialBatch = remaining <= Clock::duration::zero();
+                        if (!executePartialBatch)
+                            waitTime = remaining;
+                    }
                     if (sz == workerRequestPtr->_batchSize) {
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
                         for (int n = 0; n < sz; n++) {
@@ -540,20 +700,59 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        if (workerRequestPtr->_adaptive && sz > observed)
+                            workerRequestPtr->_statistics.RecordArrivals(sz - observed, Clock::now(), timeout);
+                        observed = 0;
+                        workerRequestPtr->_startTime = Clock::now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
-                    } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
+                    } else if (executePartialBatch && sz) {
+                        // the collection of the batch is over, have to execute the collected requests
+                        // with the lower-batch variants (if any), and the remainder in the batch1 mode
+                        std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> tasks(sz);
+                        for (auto& t : tasks)
+                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        observed = 0;
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        const auto start = Clock::now();
+                        int n = 0;
+                        // every lower-batch variant is used at most once, as the requests are busy till completion
+                        for (auto& lower : workerRequestPtr->_inferRequestsLowerBatch) {
+                            const int batch = lower.first;
+                            auto& req = lower.second;
+                            if (sz - n < batch)
+                                continue;
+                            for (int b = 0; b < batch; b++) {
+                                const auto& request = tasks[n + b].first->_inferRequest;
+                                request->CopyInputsToRequest(req, b, batch);
+                                request->_lowerBatchRequest = req;
+                                request->_wasBatchedRequestUsed =
+                                    AutoBatchInferRequest::eExecutionFlavor::LOWER_BATCH_EXECUTED;
+                            }
+                            req->SetCallback([&, n, batch](std::exception_ptr p) {
+                                workerRequestPtr->_statistics.RecordExecution(batch, Clock::now() - start);
+                                for (int b = 0; b < batch; b++) {
+                                    const auto& t = tasks[n + b];
+                                    if (p)
+                                        t.first->_inferRequest->_exceptionPtr = p;
+                                    else
+                                        t.first->_inferRequest->CopyOutputsFromRequest(req, b, batch);
+                                    t.second();
+                                    if (sz == ++arrived)
+                                        all_completed.set_value();
+                                }
+                            });
+                            req->StartAsync();
+                            n += batch;
+                        }
+                        for (; n < sz; n++) {
+                            auto t = tasks[n];
                             t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                [t, sz, start, workerRequestPtr, &arrived, &all_completed](std::exception_ptr p) {
                                     if (p)
                                         t.first->_inferRequest->_exceptionPtr = p;
+                                    workerRequestPtr->_statistics.RecordExecution(1, Clock::now() - start);
                                     t.second();
                                     if (sz == ++arrived)
                                         all_completed.set_value();
@@ -639,12 +838,22 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, reqs);
     } else if (name == METRIC_KEY(NETWORK_NAME)) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _networkWithoutBatch->GetMetric(METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(AUTO_BATCH_HISTOGRAM)) {
+        std::map<unsigned int, uint64_t> histogram;
+        {
+            std::lock_guard<std::mutex> lock(_workerRequestsMutex);
+            for (const auto& w : _workerRequests)
+                for (const auto& h : w->_statistics.GetHistogram())
+                    histogram[h.first] += h.second;
+        }
+        IE_SET_METRIC_RETURN(AUTO_BATCH_HISTOGRAM, histogram);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS,
                              {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
-                              METRIC_KEY(SUPPORTED_CONFIG_KEYS)});
+                              METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+                              METRIC_KEY(AUTO_BATCH_HISTOGRAM)});
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
                              {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
@@ -762,6 +971,10 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
                 IE_THROW(ParameterMismatch)
                     << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
             }
+        } else if (name == CONFIG_KEY(AUTO_BATCH_ADAPTIVE)) {
+            if (val != CONFIG_VALUE(YES) && val != CONFIG_VALUE(NO))
+                IE_THROW(ParameterMismatch)
+                    << " Expecting YES or NO value for " << CONFIG_KEY(AUTO_BATCH_ADAPTIVE) << " got " << val;
         }
     }
 }
@@ -779,6 +992,7 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[CONFIG_KEY(AUTO_BATCH_ADAPTIVE)] = CONFIG_VALUE(NO);
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -963,8 +1177,33 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
         }
     }
 
+    // the adaptive batch collection executes the partially collected batches with the lower-batch variants
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> executableNetworksLowerBatch;
+    const auto adaptive = fullConfig.find(CONFIG_KEY(AUTO_BATCH_ADAPTIVE));
+    if (executableNetworkWithBatch && adaptive != fullConfig.end() && adaptive->second == CONFIG_VALUE(YES)) {
+        // powers of 2 below the batch, so any partial batch is covered by each variant used at most once
+        int batch = 1;
+        while (batch * 2 < metaDevice.batchForDevice)
+            batch *= 2;
+        for (; batch > 1; batch /= 2) {
+            try {
+                CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
+                ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+                for (const auto& input : batched_inputs)
+                    shapes[input][0] = batch;
+                reshaped.reshape(shapes);
+                executableNetworksLowerBatch[batch] =
+                    ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                        : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            } catch (...) {
+                // the remainder is executed with the smaller variants or in the batch1 mode
+            }
+        }
+    }
+
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
+                                                        executableNetworksLowerBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
@@ -6,8 +6,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -29,6 +32,25 @@ struct DeviceInformation {
     int batchForDevice;
 };
 
+// Statistics of the batch collection (the requests arrival rate and the batched inference latency)
+// that drive the adaptive batch-collection policy, along with the histogram of the executed batch sizes
+class BatchStatistics {
+public:
+    using Clock = std::chrono::steady_clock;
+    void RecordArrivals(int num, Clock::time_point time, Clock::duration timeout);
+    void RecordExecution(int batchSize, Clock::duration latency);
+    // time to wait for the rest of the batch (since the first request arrived), zero means executing right away
+    Clock::duration GetWaitTime(int collected, int batchSize, Clock::duration timeout) const;
+    std::map<unsigned int, uint64_t> GetHistogram() const;
+
+protected:
+    mutable std::mutex _mutex;
+    Clock::time_point _lastArrival;
+    double _arrivalInterval = 0.;                 // moving average, in us
+    std::map<int, double> _latency;               // moving average per batch size, in us
+    std::map<unsigned int, uint64_t> _histogram;  // number of inferences per batch size
+};
+
 class AutoBatchAsyncInferRequest;
 class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
@@ -36,7 +58,12 @@ public:
     struct WorkerInferRequest {
         using Ptr = std::shared_ptr<WorkerInferRequest>;
         InferenceEngine::SoIInferRequestInternal _inferRequestBatched;
+        // requests for the lower-batch variants (largest first), to execute the partially collected batch
+        std::map<int, InferenceEngine::SoIInferRequestInternal, std::greater<int>> _inferRequestsLowerBatch;
         int _batchSize;
+        bool _adaptive = false;
+        BatchStatistics _statistics;
+        BatchStatistics::Clock::time_point _startTime;
         InferenceEngine::ThreadSafeQueueWithSize<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _tasks;
         std::vector<InferenceEngine::Task> _completionTasks;
         std::thread _thread;
@@ -48,6 +75,7 @@ public:
     explicit AutoBatchExecutableNetwork(
         const InferenceEngine::SoExecutableNetworkInternal& networkForDevice,
         const InferenceEngine::SoExecutableNetworkInternal& networkForDeviceWithoutBatch,
+        const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksForDeviceLowerBatch,
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
@@ -73,15 +101,17 @@ protected:
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> _networksLowerBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
-    std::mutex _workerRequestsMutex;
+    mutable std::mutex _workerRequestsMutex;
 
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
+    bool _adaptive = false;
 
     const std::set<std::string> _batchedInputs;
     const std::set<std::string> _batchedOutputs;
@@ -105,24 +135,43 @@ public:
                                    const std::set<std::string>& batchedIntputs,
                                    const std::set<std::string>& batchedOutputs);
 
+    // the default blobs of the request are shared with the slice of the batched request (so no copy is needed),
+    // the blobs set by the user are copied to/from the slice if those are compatible memory blobs,
+    // otherwise (e.g. remote blobs, different layouts or pre-processing) the request is executed in the batch1 mode
+    void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& userBlob) override;
+    bool IsBatchable() const {
+        return _notBatchableBlobs.empty();
+    }
     // Batch-Device impl specific: sets the data (blobs from the device request to the batched device request)
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // Batch-Device impl specific: copies the data to (from) the batch_id slice of the lower-batch request
+    void CopyInputsToRequest(InferenceEngine::SoIInferRequestInternal& req, size_t batchId, size_t batchSize);
+    void CopyOutputsFromRequest(InferenceEngine::SoIInferRequestInternal& req, size_t batchId, size_t batchSize);
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
+    InferenceEngine::SoIInferRequestInternal _lowerBatchRequest;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        LOWER_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
     size_t _batchSize;
+    // memory layout of the blobs shared with the batched request
+    std::map<std::string, InferenceEngine::TensorDesc> _sharedBlobsDescs;
+    std::set<std::string> _notBatchableBlobs;
 };
 
 class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
@@ -16,6 +16,10 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     : AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
     _pipeline.clear();
+    if (_heteroInferRequest->IsPipelined()) {
+        CreatePipelinedStages();
+        return;
+    }
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
@@ -44,11 +48,62 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     }
 }
 
+void HeteroAsyncInferRequest::CreatePipelinedStages() {
+    for (std::size_t stage = 0; stage < _heteroInferRequest->_inferRequests.size(); ++stage) {
+        // takes the request from the stage pool, so the stage of this request overlaps with the other stages
+        // of the other requests and the request waits in the queue if all the stage requests are busy
+        struct StageExecutor : ITaskExecutor {
+            StageExecutor(HeteroInferRequest& heteroRequest, std::size_t stage)
+                : _heteroRequest(heteroRequest),
+                  _stage(stage) {}
+            void run(Task task) override {
+                _task = std::move(task);
+                _exceptionPtr = nullptr;
+                _heteroRequest.AcquireStageRequest(_stage, [this](SoIInferRequestInternal& inferRequest) {
+                    try {
+                        _heteroRequest.BindStageBlobs(_stage, inferRequest);
+                        inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
+                            _exceptionPtr = exceptionPtr;
+                            auto capturedTask = std::move(_task);
+                            capturedTask();
+                        });
+                        inferRequest->StartAsync();
+                    } catch (...) {
+                        _exceptionPtr = std::current_exception();
+                        auto capturedTask = std::move(_task);
+                        capturedTask();
+                    }
+                });
+            };
+            HeteroInferRequest& _heteroRequest;
+            std::size_t _stage;
+            std::exception_ptr _exceptionPtr;
+            Task _task;
+        };
+
+        auto stageExecutor = std::make_shared<StageExecutor>(*_heteroInferRequest, stage);
+        auto heteroInferRequest = _heteroInferRequest;
+        _pipeline.emplace_back(stageExecutor, [stageExecutor, heteroInferRequest, stage] {
+            // the outputs are written to the blobs of the HETERO request, so the stage request can be reused
+            heteroInferRequest->ReleaseStageRequest(stage);
+            if (nullptr != stageExecutor->_exceptionPtr) {
+                std::rethrow_exception(stageExecutor->_exceptionPtr);
+            }
+        });
+    }
+    // the pool requests are asynchronous, so the synchronous inference waits for the same pipeline
+    _syncPipeline = _pipeline;
+}
+
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     auto waitStatus = StatusCode::OK;
     try {
         waitStatus = AsyncInferRequestThreadSafeDefault::Wait(millis_timeout);
     } catch (...) {
+        // in the pipelined mode the stage requests are released by the pipeline
+        if (_heteroInferRequest->IsPipelined()) {
+            throw;
+        }
         for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
             requestDesc._request->Wait(InferRequest::RESULT_READY);
         }
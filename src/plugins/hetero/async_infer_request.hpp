@@ -22,6 +22,8 @@ public:
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
 
 private:
+    void CreatePipelinedStages();
+
     HeteroInferRequest::Ptr _heteroInferRequest;
 };
 
@@ -0,0 +1,360 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cost_model_partitioner.hpp"
+
+#include <ie_common.h>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <limits>
+#include <ngraph/op/util/op_types.hpp>
+#include <sstream>
+
+using namespace HeteroPlugin;
+
+namespace {
+
+constexpr double infinity = std::numeric_limits<double>::infinity();
+
+std::string Trim(const std::string& str) {
+    const auto begin = str.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) {
+        return {};
+    }
+    const auto end = str.find_last_not_of(" \t\r");
+    return str.substr(begin, end - begin + 1);
+}
+
+}  // namespace
+
+CostModelPartitioner::Costs CostModelPartitioner::ReadCosts(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        IE_THROW() << "Can't open the HETERO node costs file " << path;
+    }
+
+    Costs costs;
+    std::string line;
+    while (std::getline(file, line)) {
+        line = Trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        // the node name may contain spaces, so the device is the first token and the cost is the last one
+        const auto first = line.find_first_of(" \t");
+        const auto last = line.find_last_of(" \t");
+        if (first == std::string::npos) {
+            IE_THROW() << "Wrong line in the HETERO node costs file " << path << ": " << line;
+        }
+        const auto device = line.substr(0, first);
+        double cost = 0.;
+        try {
+            cost = std::stod(line.substr(last + 1));
+        } catch (const std::exception&) {
+            IE_THROW() << "Wrong cost in the HETERO node costs file " << path << ": " << line;
+        }
+        if (device == "transfer") {
+            costs.transferPerMegabyte = cost;
+        } else {
+            const auto name = Trim(line.substr(first, last - first));
+            if (name.empty()) {
+                IE_THROW() << "Wrong line in the HETERO node costs file " << path << ": " << line;
+            }
+            costs.nodes[device][name] = cost;
+        }
+    }
+    return costs;
+}
+
+CostModelPartitioner::CostModelPartitioner(const std::shared_ptr<const ov::Model>& model,
+                                           const std::vector<std::string>& devices,
+                                           const std::map<std::string, std::unordered_set<std::string>>& supported,
+                                           const Costs& costs)
+    : _devices(devices),
+      _transferPerMegabyte(costs.transferPerMegabyte) {
+    for (auto&& node : model->get_ordered_ops()) {
+        if (!ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node)) {
+            _nodes.push_back(node);
+        }
+    }
+
+    _costs.resize(_nodes.size(), std::vector<double>(_devices.size(), infinity));
+    for (std::size_t d = 0; d < _devices.size(); ++d) {
+        auto itSupported = supported.find(_devices[d]);
+        auto itCosts = costs.nodes.find(_devices[d]);
+        for (std::size_t i = 0; i < _nodes.size(); ++i) {
+            const auto& name = _nodes[i]->get_friendly_name();
+            if (itSupported == supported.end() || itSupported->second.count(name) == 0) {
+                continue;
+            }
+            // the nodes missed in the profile are considered to be free
+            double cost = 0.;
+            if (itCosts != costs.nodes.end()) {
+                auto itCost = itCosts->second.find(name);
+                if (itCost != itCosts->second.end()) {
+                    cost = itCost->second;
+                }
+            }
+            _costs[i][d] = cost;
+        }
+    }
+
+    // each tensor is counted at every boundary between its producer and the last consumer
+    std::unordered_map<const ov::Node*, std::size_t> positions;
+    for (std::size_t i = 0; i < _nodes.size(); ++i) {
+        positions.emplace(_nodes[i].get(), i);
+    }
+    std::vector<std::int64_t> delta(_nodes.size() + 1, 0);
+    for (std::size_t i = 0; i < _nodes.size(); ++i) {
+        for (auto&& output : _nodes[i]->outputs()) {
+            std::size_t lastConsumer = i;
+            for (auto&& input : output.get_target_inputs()) {
+                auto itPosition = positions.find(input.get_node());
+                if (itPosition != positions.end()) {
+                    lastConsumer = std::max(lastConsumer, itPosition->second);
+                }
+            }
+            if (lastConsumer == i || output.get_partial_shape().is_dynamic()) {
+                continue;
+            }
+            const auto bytes =
+                static_cast<std::int64_t>(ov::shape_size(output.get_shape()) * output.get_element_type().size());
+            delta[i + 1] += bytes;
+            delta[lastConsumer + 1] -= bytes;
+        }
+    }
+    _cutBytes.resize(_nodes.size(), 0);
+    std::int64_t bytes = 0;
+    for (std::size_t i = 0; i < _nodes.size(); ++i) {
+        bytes += delta[i];
+        _cutBytes[i] = static_cast<std::uint64_t>(bytes);
+    }
+}
+
+double CostModelPartitioner::Cost(std::size_t node, std::size_t device) const {
+    return _costs[node][device];
+}
+
+double CostModelPartitioner::CutCost(std::size_t position) const {
+    return position == 0 ? 0. : _cutBytes[position] / (1024. * 1024.) * _transferPerMegabyte;
+}
+
+std::vector<std::size_t> CostModelPartitioner::MinimizeLatency() const {
+    const auto nodesNum = _nodes.size();
+    const auto devicesNum = _devices.size();
+    // latency of the prefix ending with the node on the device and the device of the previous node
+    std::vector<std::vector<double>> latency(nodesNum, std::vector<double>(devicesNum, infinity));
+    std::vector<std::vector<std::size_t>> previous(nodesNum, std::vector<std::size_t>(devicesNum, 0));
+    for (std::size_t d = 0; d < devicesNum; ++d) {
+        latency[0][d] = Cost(0, d);
+    }
+    for (std::size_t i = 1; i < nodesNum; ++i) {
+        for (std::size_t d = 0; d < devicesNum; ++d) {
+            if (Cost(i, d) == infinity) {
+                continue;
+            }
+            for (std::size_t p = 0; p < devicesNum; ++p) {
+                const auto candidate = latency[i - 1][p] + (p == d ? 0. : CutCost(i));
+                if (candidate < latency[i][d]) {
+                    latency[i][d] = candidate;
+                    previous[i][d] = p;
+                }
+            }
+            latency[i][d] += Cost(i, d);
+        }
+    }
+
+    const auto& last = latency.back();
+    auto device = static_cast<std::size_t>(std::distance(last.begin(), std::min_element(last.begin(), last.end())));
+    if (last[device] == infinity) {
+        IE_THROW() << "Hetero device can't assign all the nodes to the pointed devices";
+    }
+    std::vector<std::size_t> assignment(nodesNum);
+    for (std::size_t i = nodesNum; i-- > 0;) {
+        assignment[i] = device;
+        device = previous[i][device];
+    }
+    return assignment;
+}
+
+std::vector<std::size_t> CostModelPartitioner::MaximizeThroughput() const {
+    const auto nodesNum = _nodes.size();
+    const auto devicesNum = _devices.size();
+    if (devicesNum > 16) {
+        IE_THROW() << "Hetero throughput partitioning supports up to 16 devices";
+    }
+
+    // prefix sums of the finite costs and the number of the unsupported nodes per device
+    std::vector<std::vector<double>> costSums(devicesNum, std::vector<double>(nodesNum + 1, 0.));
+    std::vector<std::vector<std::size_t>> unsupportedSums(devicesNum, std::vector<std::size_t>(nodesNum + 1, 0));
+    double totalCost = 0.;
+    for (std::size_t d = 0; d < devicesNum; ++d) {
+        for (std::size_t i = 0; i < nodesNum; ++i) {
+            const auto cost = Cost(i, d);
+            costSums[d][i + 1] = costSums[d][i] + (cost == infinity ? 0. : cost);
+            unsupportedSums[d][i + 1] = unsupportedSums[d][i] + (cost == infinity ? 1 : 0);
+        }
+        totalCost = std::max(totalCost, costSums[d][nodesNum]);
+    }
+    for (std::size_t i = 1; i < nodesNum; ++i) {
+        totalCost += CutCost(i);
+    }
+
+    // the furthest end of the stage starting at the position on the device with the cost within the limit
+    auto stageEnd = [&](std::size_t begin, std::size_t d, double limit) {
+        std::size_t lo = begin, hi = nodesNum;
+        while (lo < hi) {
+            const auto mid = (lo + hi + 1) / 2;
+            const bool supported = unsupportedSums[d][mid] == unsupportedSums[d][begin];
+            if (supported && CutCost(begin) + costSums[d][mid] - costSums[d][begin] <= limit) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        return lo;
+    };
+
+    // every device executes at most one stage, the stages go in the topological order in any order of the devices,
+    // so the state is the set of the used devices with the furthest covered prefix (greedy stage extension)
+    const std::size_t masksNum = std::size_t{1} << devicesNum;
+    struct State {
+        std::size_t covered = 0;
+        std::size_t previousMask = 0;
+        std::size_t device = 0;
+        std::size_t begin = 0;
+    };
+    auto tryLimit = [&](double limit, std::vector<State>& states) {
+        states.assign(masksNum, State{});
+        for (std::size_t mask = 0; mask < masksNum; ++mask) {
+            if (mask != 0 && states[mask].covered == 0) {
+                continue;
+            }
+            const auto begin = states[mask].covered;
+            if (begin == nodesNum) {
+                return mask;
+            }
+            for (std::size_t d = 0; d < devicesNum; ++d) {
+                const auto nextMask = mask | (std::size_t{1} << d);
+                if (nextMask == mask) {
+                    continue;
+                }
+                const auto end = stageEnd(begin, d, limit);
+                if (end > begin && end > states[nextMask].covered) {
+                    states[nextMask] = {end, mask, d, begin};
+                }
+            }
+        }
+        return masksNum;
+    };
+
+    std::vector<State> states;
+    if (tryLimit(totalCost, states) == masksNum) {
+        IE_THROW() << "Hetero device can't split the network into the pipeline stages on the pointed devices";
+    }
+    double lo = 0., hi = totalCost;
+    for (int iteration = 0; iteration < 64 && hi - lo > 1e-6 * std::max(1., hi); ++iteration) {
+        const auto mid = (lo + hi) / 2;
+        if (tryLimit(mid, states) != masksNum) {
+            hi = mid;
+        } else {
+            lo = mid;
+        }
+    }
+
+    auto mask = tryLimit(hi, states);
+    std::vector<std::size_t> assignment(nodesNum);
+    while (mask != 0) {
+        const auto& state = states[mask];
+        for (std::size_t i = state.begin; i < state.covered; ++i) {
+            assignment[i] = state.device;
+        }
+        mask = state.previousMask;
+    }
+    return assignment;
+}
+
+std::map<std::string, std::string> CostModelPartitioner::Run(Objective objective) {
+    _objective = objective;
+    if (_nodes.empty()) {
+        _assignment.clear();
+        return {};
+    }
+    _assignment = objective == Objective::Latency ? MinimizeLatency() : MaximizeThroughput();
+
+    std::map<std::string, std::string> affinities;
+    for (std::size_t i = 0; i < _nodes.size(); ++i) {
+        affinities.emplace(_nodes[i]->get_friendly_name(), _devices[_assignment[i]]);
+    }
+    return affinities;
+}
+
+void CostModelPartitioner::DumpDot(const std::string& path) const {
+    static const std::array<const char*, 6> colors = {
+        "aquamarine", "lightpink", "lightskyblue", "khaki", "palegreen", "plum"};
+
+    std::vector<double> deviceCosts(_devices.size(), 0.);
+    std::vector<double> stageCosts;
+    double latency = 0.;
+    for (std::size_t i = 0; i < _assignment.size(); ++i) {
+        const bool newStage = i == 0 || _assignment[i] != _assignment[i - 1];
+        const auto cost = Cost(i, _assignment[i]) + (newStage ? CutCost(i) : 0.);
+        if (newStage) {
+            stageCosts.push_back(0.);
+        }
+        stageCosts.back() += cost;
+        deviceCosts[_assignment[i]] += cost;
+        latency += cost;
+    }
+
+    std::ofstream dot(path);
+    if (!dot.is_open()) {
+        IE_THROW() << "Can't open the file " << path << " to dump the HETERO partition";
+    }
+    std::unordered_map<const ov::Node*, std::size_t> positions;
+    for (std::size_t i = 0; i < _nodes.size(); ++i) {
+        positions.emplace(_nodes[i].get(), i);
+    }
+
+    dot << "digraph partition {\n";
+    dot << "  label=\"objective=" << (_objective == Objective::Latency ? "LATENCY" : "THROUGHPUT")
+        << "\\npredicted latency=" << latency << " us";
+    if (!stageCosts.empty()) {
+        dot << "\\npredicted slowest stage=" << *std::max_element(stageCosts.begin(), stageCosts.end()) << " us";
+    }
+    for (std::size_t d = 0; d < _devices.size(); ++d) {
+        dot << "\\n" << _devices[d] << "=" << deviceCosts[d] << " us";
+    }
+    dot << "\";\n";
+    for (std::size_t i = 0; i < _nodes.size(); ++i) {
+        const auto device = _assignment[i];
+        dot << "  n" << i << " [shape=box style=filled fillcolor=" << colors[device % colors.size()] << " label=\""
+            << _nodes[i]->get_friendly_name() << "\\n" << _nodes[i]->get_type_name() << "\\ndevice=" << _devices[device]
+            << "\\ncost=" << Cost(i, device) << " us\"];\n";
+    }
+    for (std::size_t i = 0; i < _nodes.size(); ++i) {
+        for (auto&& output : _nodes[i]->outputs()) {
+            for (auto&& input : output.get_target_inputs()) {
+                auto itPosition = positions.find(input.get_node());
+                if (itPosition == positions.end()) {
+                    continue;
+                }
+                dot << "  n" << i << " -> n" << itPosition->second;
+                if (_assignment[i] != _assignment[itPosition->second]) {
+                    dot << " [color=red label=\"";
+                    if (output.get_partial_shape().is_static()) {
+                        dot << ov::shape_size(output.get_shape()) * output.get_element_type().size() << " B";
+                    } else {
+                        dot << "dynamic";
+                    }
+                    dot << "\"]";
+                }
+                dot << ";\n";
+            }
+        }
+    }
+    dot << "}\n";
+}
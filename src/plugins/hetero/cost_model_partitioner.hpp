@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <openvino/core/model.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Assigns the nodes to the devices using the per node cost estimates instead of the devices priority.
+ * The nodes are split into the segments of the topological order, each segment is executed on a single device and
+ * the tensors crossing the boundary of the segments are transferred with the cost proportional to their size.
+ *  - Latency objective minimizes the sum of the node and transfer costs, so any device can execute several segments.
+ *  - Throughput objective minimizes the cost of the slowest pipeline stage, where every device executes one segment
+ *    (the stage) and pays for the transfer of its inputs.
+ * The constants, parameters and results are not partitioned, they follow the affinity of the connected nodes.
+ */
+class CostModelPartitioner {
+public:
+    enum class Objective { Latency, Throughput };
+
+    struct Costs {
+        // cost of the node execution in microseconds per device and node friendly name
+        std::unordered_map<std::string, std::unordered_map<std::string, double>> nodes;
+        double transferPerMegabyte = 0.;
+    };
+
+    /**
+     * @brief Reads the costs from the text file with the lines:
+     *   <device> <node friendly name> <microseconds>, e.g. the perf counters of the profiling run on the device
+     *   transfer <microseconds per megabyte of the tensors transferred between the devices>
+     * The empty lines and the lines starting with # are skipped
+     */
+    static Costs ReadCosts(const std::string& path);
+
+    /**
+     * @param supported The friendly names of the nodes supported per device (QueryNetwork result)
+     */
+    CostModelPartitioner(const std::shared_ptr<const ov::Model>& model,
+                         const std::vector<std::string>& devices,
+                         const std::map<std::string, std::unordered_set<std::string>>& supported,
+                         const Costs& costs);
+
+    // Returns the device per node friendly name
+    std::map<std::string, std::string> Run(Objective objective);
+
+    // Writes the chosen partition with the predicted costs in GraphViz format
+    void DumpDot(const std::string& path) const;
+
+private:
+    double Cost(std::size_t node, std::size_t device) const;
+    double CutCost(std::size_t position) const;
+    std::vector<std::size_t> MinimizeLatency() const;
+    std::vector<std::size_t> MaximizeThroughput() const;
+
+    std::vector<std::shared_ptr<const ov::Node>> _nodes;
+    std::vector<std::string> _devices;
+    // node costs per device, infinity for the nodes not supported by the device
+    std::vector<std::vector<double>> _costs;
+    // bytes of the tensors produced before the position and consumed at or after it
+    std::vector<std::uint64_t> _cutBytes;
+    double _transferPerMegabyte;
+    Objective _objective = Objective::Latency;
+    std::vector<std::size_t> _assignment;
+};
+
+}  // namespace HeteroPlugin
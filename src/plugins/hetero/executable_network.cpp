@@ -6,6 +6,7 @@
 #include "ie_metric_helpers.hpp"
 #include "executable_network.hpp"
 #include "async_infer_request.hpp"
+#include "cost_model_partitioner.hpp"
 #include "itt.hpp"
 #include "ie_precision.hpp"
 #include "openvino/core/dimension.hpp"
@@ -91,19 +92,72 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         }
     }
 
-    if (queryNetworkResult.supportedLayersMap.empty()) {
+    // the cost model assigns the layers which have no affinity set by the user
+    auto itPartitioning = _config.find(HETERO_CONFIG_KEY(PARTITIONING));
+    const bool useCostModel = itPartitioning != _config.end() && !itPartitioning->second.empty();
+    if (queryNetworkResult.supportedLayersMap.empty() || useCostModel) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
             it = _config.find(ov::device::priorities.name());
         }
-        if (it != _config.end()) {
-            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
-        } else {
+        if (it == _config.end()) {
             IE_THROW() << "The '" << ov::device::priorities.name()
                        << "' option was not defined for heterogeneous plugin";
+        } else if (!useCostModel) {
+            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
+        } else {
+            CostModelPartitioner::Objective objective;
+            if (itPartitioning->second == CONFIG_VALUE(LATENCY)) {
+                objective = CostModelPartitioner::Objective::Latency;
+            } else if (itPartitioning->second == CONFIG_VALUE(THROUGHPUT)) {
+                objective = CostModelPartitioner::Objective::Throughput;
+            } else {
+                IE_THROW() << "Wrong value for property key " << HETERO_CONFIG_KEY(PARTITIONING)
+                           << ". Expected only empty string, " << CONFIG_VALUE(LATENCY) << " or "
+                           << CONFIG_VALUE(THROUGHPUT);
+            }
+            auto itCosts = _config.find(HETERO_CONFIG_KEY(NODE_COSTS));
+            if (itCosts == _config.end() || itCosts->second.empty()) {
+                IE_THROW() << "The " << HETERO_CONFIG_KEY(PARTITIONING) << " requires the "
+                           << HETERO_CONFIG_KEY(NODE_COSTS) << " option to be defined";
+            }
+
+            // the devices which don't support the node can't be selected for it regardless of the cost
+            std::vector<std::string> devices;
+            std::map<std::string, std::unordered_set<std::string>> supported;
+            for (auto&& deviceResult : _heteroPlugin->QueryDevices(network, _config)) {
+                devices.push_back(deviceResult.first);
+                auto& deviceSupported = supported[deviceResult.first];
+                for (auto&& layer : deviceResult.second.supportedLayersMap) {
+                    deviceSupported.insert(layer.first);
+                }
+            }
+            // the user affinities pin the layers, so only the affinity device can be selected for them
+            for (auto&& affinity : queryNetworkResult.supportedLayersMap) {
+                if (std::find(devices.begin(), devices.end(), affinity.second) == devices.end()) {
+                    IE_THROW() << "The layer " << affinity.first << " has the affinity " << affinity.second
+                               << " which is not in the '" << ov::device::priorities.name() << "' option";
+                }
+                for (auto&& deviceSupported : supported) {
+                    if (deviceSupported.first == affinity.second) {
+                        deviceSupported.second.insert(affinity.first);
+                    } else {
+                        deviceSupported.second.erase(affinity.first);
+                    }
+                }
+            }
+            CostModelPartitioner partitioner{clonedFunction,
+                                             devices,
+                                             supported,
+                                             CostModelPartitioner::ReadCosts(itCosts->second)};
+            for (auto&& affinity : partitioner.Run(objective)) {
+                queryNetworkResult.supportedLayersMap.emplace(affinity);
+            }
+            if (dumpDotFile) {
+                partitioner.DumpDot("hetero_partition_" + _name + ".dot");
+            }
         }
     }
-
     using Input = ngraph::Input<ngraph::Node>;
     using NodeSet = std::unordered_set<ngraph::Node*>;
     using InputSet = std::set<Input>;
@@ -516,6 +570,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                                                                  network._device,
                                                                  metaDevices[network._device]);
     }
+    InitPipeline();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
@@ -671,6 +726,28 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+    InitPipeline();
+}
+
+void HeteroExecutableNetwork::InitPipeline() {
+    auto itPipeline = _config.find(HETERO_CONFIG_KEY(PIPELINE));
+    if (itPipeline == _config.end() || itPipeline->second == NO) {
+        return;
+    } else if (itPipeline->second != YES) {
+        IE_THROW() << "Wrong value for property key " << HETERO_CONFIG_KEY(PIPELINE) << ". Expected only YES/NO";
+    }
+
+    for (auto&& desc : _networks) {
+        for (auto&& input : desc._network->getInputs()) {
+            if (input->get_output_partial_shape(0).is_dynamic()) {
+                IE_THROW(NotImplemented) << "The HETERO pipelined mode doesn't support dynamic shapes";
+            }
+        }
+        // the number of the requests keeping the device busy is enough for the stage, since the stage
+        // requests are released as soon as the stage is executed
+        auto poolSize = desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        _stagePools.push_back(std::make_shared<StageRequestPool>(desc._network, std::max(poolSize, 1u)));
+    }
 }
 
 void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
@@ -817,7 +894,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
-    return std::make_shared<HeteroInferRequest>(inputs, outputs, inferRequests, _blobNameMap);
+    return std::make_shared<HeteroInferRequest>(inputs, outputs, inferRequests, _blobNameMap, _stagePools);
 }
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
@@ -830,7 +907,11 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(Input
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
-    return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, inferRequests, _blobNameMap);
+    return std::make_shared<HeteroInferRequest>(networkInputs,
+                                                networkOutputs,
+                                                inferRequests,
+                                                _blobNameMap,
+                                                _stagePools);
 }
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequest() {
@@ -853,6 +934,13 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING) || name == HETERO_CONFIG_KEY(NODE_COSTS)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{};
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE)) {
+        // the networks exported before the pipelined mode was introduced don't have the key
+        auto it = _config.find(name);
+        result = it != _config.end() && it->second == YES;
     } else {
         // find config key among plugin config keys
         for (auto&& desc : _networks) {
@@ -933,6 +1021,9 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(PIPELINE),
+                                                     HETERO_CONFIG_KEY(PARTITIONING),
+                                                     HETERO_CONFIG_KEY(NODE_COSTS),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
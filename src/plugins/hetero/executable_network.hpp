@@ -65,6 +65,7 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork& network);
     void InitNgraph(const InferenceEngine::CNNNetwork& network);
+    void InitPipeline();
 
     struct NetworkDesc {
         std::string _device;
@@ -77,6 +78,8 @@ private:
     std::string _name;
     std::map<std::string, std::string> _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    // per subnetwork request pools shared by the infer requests in the pipelined mode
+    std::vector<StageRequestPool::Ptr> _stagePools;
 };
 
 }  // namespace HeteroPlugin
@@ -7,9 +7,11 @@
 #include <ie_blob.h>
 #include <ie_layouts.h>
 
+#include <blob_factory.hpp>
 #include <cassert>
 #include <description_buffer.hpp>
 #include <ie_algorithm.hpp>
+#include <future>
 #include <map>
 #include <string>
 
@@ -23,9 +25,11 @@ HeteroInferRequest::HeteroInferRequest(
     const std::vector<std::shared_ptr<const ov::Node>>& inputs,
     const std::vector<std::shared_ptr<const ov::Node>>& outputs,
     const SubRequestsList& inferRequests,
-    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames)
+    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames,
+    const std::vector<StageRequestPool::Ptr>& stagePools)
     : IInferRequestInternal(inputs, outputs),
-      _inferRequests(inferRequests) {
+      _inferRequests(inferRequests),
+      _stagePools(stagePools) {
     CreateInferRequest(subgraphInputToOutputBlobNames);
 }
 
@@ -33,9 +37,11 @@ HeteroInferRequest::HeteroInferRequest(
     InferenceEngine::InputsDataMap networkInputs,
     InferenceEngine::OutputsDataMap networkOutputs,
     const SubRequestsList& inferRequests,
-    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames)
+    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames,
+    const std::vector<StageRequestPool::Ptr>& stagePools)
     : IInferRequestInternal(networkInputs, networkOutputs),
-      _inferRequests(inferRequests) {
+      _inferRequests(inferRequests),
+      _stagePools(stagePools) {
     CreateInferRequest(subgraphInputToOutputBlobNames);
 }
 
@@ -44,6 +50,10 @@ void HeteroInferRequest::CreateInferRequest(
     if (_networkOutputs.empty() || _networkInputs.empty()) {
         IE_THROW() << "Internal error: no information about network's output/input";
     }
+    if (IsPipelined()) {
+        CreatePipelinedBlobs(subgraphInputToOutputBlobNames);
+        return;
+    }
 
     auto requestBlob([&](const std::string& blobName, InferenceEngine::SoIInferRequestInternal& r, bool output) {
         std::string intermediateBlobName = blobName;
@@ -85,7 +95,91 @@ void HeteroInferRequest::CreateInferRequest(
     }
 }
 
+void HeteroInferRequest::CreatePipelinedBlobs(
+    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) {
+    auto blobName = [&](const std::string& name) {
+        auto itName = subgraphInputToOutputBlobNames.find(name);
+        return itName != subgraphInputToOutputBlobNames.end() ? itName->second : name;
+    };
+    auto allocateBlob = [&](const std::string& name, const TensorDesc& desc) {
+        if (_blobs.find(name) == _blobs.end()) {
+            auto blob = make_blob_with_precision(desc);
+            blob->allocate();
+            _blobs.emplace(name, blob);
+        }
+    };
+
+    // the blobs are allocated by the producers, so the consumers of the intermediate blobs are bound to them
+    _stageBlobNames.resize(_inferRequests.size());
+    for (std::size_t stage = 0; stage < _inferRequests.size(); ++stage) {
+        for (auto&& outputInfo : _inferRequests[stage]._network->GetOutputsInfo()) {
+            const auto name = InferenceEngine::details::contains(_networkOutputs, outputInfo.first)
+                                  ? outputInfo.first
+                                  : blobName(outputInfo.first);
+            allocateBlob(name, outputInfo.second->getTensorDesc());
+            _stageBlobNames[stage].emplace(outputInfo.first, name);
+        }
+    }
+    for (std::size_t stage = 0; stage < _inferRequests.size(); ++stage) {
+        for (auto&& inputInfo : _inferRequests[stage]._network->GetInputsInfo()) {
+            if (InferenceEngine::details::contains(_networkInputs, inputInfo.first)) {
+                allocateBlob(inputInfo.first, inputInfo.second->getTensorDesc());
+                _stageBlobNames[stage].emplace(inputInfo.first, inputInfo.first);
+            } else {
+                const auto name = blobName(inputInfo.first);
+                if (_blobs.find(name) == _blobs.end()) {
+                    IE_THROW() << "Internal error: no producer of the intermediate blob " << name;
+                }
+                _stageBlobNames[stage].emplace(inputInfo.first, name);
+            }
+        }
+    }
+    _stageRequestIds.resize(_inferRequests.size(), 0);
+    _stagePerfCounts.resize(_inferRequests.size());
+}
+
+void HeteroInferRequest::AcquireStageRequest(std::size_t stage,
+                                             const std::function<void(SoIInferRequestInternal&)>& task) {
+    auto pool = _stagePools.at(stage);
+    pool->Acquire([this, stage, pool, task](std::size_t id) {
+        _stageRequestIds[stage] = id;
+        task(pool->Get(id));
+    });
+}
+
+void HeteroInferRequest::BindStageBlobs(std::size_t stage, SoIInferRequestInternal& request) {
+    // the pool request may have been bound to the blobs of the other HETERO request
+    for (auto&& blobName : _stageBlobNames[stage]) {
+        auto& blob = _blobs.at(blobName.second);
+        if (request->GetBlob(blobName.first) != blob) {
+            request->SetBlob(blobName.first, blob);
+        }
+    }
+}
+
+void HeteroInferRequest::ReleaseStageRequest(std::size_t stage) {
+    auto& pool = _stagePools.at(stage);
+    const auto id = _stageRequestIds[stage];
+    // the pool request is reused by the other HETERO requests, so its counters are taken before it's released
+    if (pool->CollectsPerfCounters()) {
+        try {
+            _stagePerfCounts[stage] = pool->Get(id)->GetPerformanceCounts();
+        } catch (...) {
+            _stagePerfCounts[stage].clear();
+        }
+    }
+    pool->Release(id);
+}
+
 void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+    if (IsPipelined()) {
+        if (!InferenceEngine::details::contains(_networkInputs, name) &&
+            !InferenceEngine::details::contains(_networkOutputs, name)) {
+            IE_THROW() << "There is no network input or output with name: " << name;
+        }
+        _blobs[name] = blob;
+        return;
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -94,6 +188,13 @@ void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine:
 }
 
 InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name) {
+    if (IsPipelined()) {
+        if (!InferenceEngine::details::contains(_networkInputs, name) &&
+            !InferenceEngine::details::contains(_networkOutputs, name)) {
+            IE_THROW() << "There is no network input or output with name: " << name;
+        }
+        return _blobs.at(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -102,6 +203,9 @@ InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name)
 }
 
 void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob, const PreProcessInfo& info) {
+    if (IsPipelined()) {
+        IE_THROW(NotImplemented) << "Preprocessing is not supported in the HETERO pipelined mode";
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -110,6 +214,9 @@ void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob,
 }
 
 const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const std::string& name) const {
+    if (IsPipelined()) {
+        return IInferRequestInternal::GetPreProcess(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -118,6 +225,27 @@ const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const s
 }
 
 void HeteroInferRequest::InferImpl() {
+    if (IsPipelined()) {
+        for (std::size_t stage = 0; stage < _inferRequests.size(); ++stage) {
+            OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, _inferRequests[stage]._profilingTask);
+            std::promise<void> acquired;
+            SoIInferRequestInternal* r = nullptr;
+            AcquireStageRequest(stage, [&](SoIInferRequestInternal& request) {
+                r = &request;
+                acquired.set_value();
+            });
+            acquired.get_future().wait();
+            try {
+                BindStageBlobs(stage, *r);
+                (*r)->Infer();
+            } catch (...) {
+                ReleaseStageRequest(stage);
+                throw;
+            }
+            ReleaseStageRequest(stage);
+        }
+        return;
+    }
     for (auto&& desc : _inferRequests) {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
         auto& r = desc._request;
@@ -129,7 +257,8 @@ void HeteroInferRequest::InferImpl() {
 std::map<std::string, InferenceEngineProfileInfo> HeteroInferRequest::GetPerformanceCounts() const {
     std::map<std::string, InferenceEngineProfileInfo> perfMap;
     for (size_t i = 0; i < _inferRequests.size(); i++) {
-        auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
+        auto perfMapRequest =
+            IsPipelined() ? _stagePerfCounts[i] : _inferRequests[i]._request->GetPerformanceCounts();
         for (auto&& r : perfMapRequest) {
             perfMap[std::string("subgraph") + std::to_string(i) + ": " + r.first] = r.second;
         }
@@ -8,6 +8,7 @@
 
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <functional>
 #include <map>
 #include <memory>
 #include <openvino/itt.hpp>
@@ -15,6 +16,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "stage_request_pool.hpp"
+
 namespace HeteroPlugin {
 
 class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
@@ -31,12 +34,14 @@ public:
     HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                        InferenceEngine::OutputsDataMap networkOutputs,
                        const SubRequestsList& inferRequests,
-                       const std::unordered_map<std::string, std::string>& blobNameMap);
+                       const std::unordered_map<std::string, std::string>& blobNameMap,
+                       const std::vector<StageRequestPool::Ptr>& stagePools = {});
 
     HeteroInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& networkInputs,
                        const std::vector<std::shared_ptr<const ov::Node>>& networkOutputs,
                        const SubRequestsList& inferRequests,
-                       const std::unordered_map<std::string, std::string>& blobNameMap);
+                       const std::unordered_map<std::string, std::string>& blobNameMap,
+                       const std::vector<StageRequestPool::Ptr>& stagePools = {});
 
     void InferImpl() override;
 
@@ -52,12 +57,38 @@ public:
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
+    /**
+     * @brief In the pipelined mode the subnetwork requests are taken from the per stage pools for the time of
+     * the stage execution only, while all the network and intermediate blobs are owned by the HETERO request.
+     * So the stage k of one request overlaps with the stage k+1 of the other one.
+     */
+    bool IsPipelined() const {
+        return !_stagePools.empty();
+    }
+
+    /**
+     * @brief Calls the task with the pool request of the stage, the request must be bound with BindStageBlobs
+     * before the inference and released with ReleaseStageRequest after it
+     */
+    void AcquireStageRequest(std::size_t stage, const std::function<void(InferenceEngine::SoIInferRequestInternal&)>& task);
+    void BindStageBlobs(std::size_t stage, InferenceEngine::SoIInferRequestInternal& request);
+    void ReleaseStageRequest(std::size_t stage);
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
     std::map<std::string, InferenceEngine::IInferRequestInternal*> _subRequestFromBlobName;
 
 private:
     void CreateInferRequest(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
+    void CreatePipelinedBlobs(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
+
+    std::vector<StageRequestPool::Ptr> _stagePools;
+    // the id of the pool request acquired by the running stage
+    std::vector<std::size_t> _stageRequestIds;
+    // the counters of the last execution of the stage taken before the pool request is released
+    std::vector<std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>> _stagePerfCounts;
+    // the subnetwork blob names mapped to the names of the blobs in _blobs per stage
+    std::vector<std::map<std::string, std::string>> _stageBlobNames;
 };
 
 }  // namespace HeteroPlugin
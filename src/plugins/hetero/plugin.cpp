@@ -27,6 +27,9 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINE)] = NO;
+    _config[HETERO_CONFIG_KEY(PARTITIONING)] = "";
+    _config[HETERO_CONFIG_KEY(NODE_COSTS)] = "";
 }
 
 namespace {
@@ -40,6 +43,9 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
 
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(PIPELINE),
+                                                                  HETERO_CONFIG_KEY(PARTITIONING),
+                                                                  HETERO_CONFIG_KEY(NODE_COSTS),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name(),
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
@@ -116,9 +122,8 @@ void Engine::SetConfig(const Configs& configs) {
     }
 }
 
-QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs& config) const {
-    QueryNetworkResult qr;
-
+std::vector<std::pair<std::string, QueryNetworkResult>> Engine::QueryDevices(const CNNNetwork& network,
+                                                                             const Configs& config) const {
     if (GetCore() == nullptr) {
         IE_THROW() << "Please, work with HETERO device via InferencEngine::Core object";
     }
@@ -149,8 +154,18 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
+    std::vector<std::pair<std::string, QueryNetworkResult>> devicesResults;
     for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+        devicesResults.emplace_back(deviceName, queryResults[deviceName]);
+    }
+    return devicesResults;
+}
+
+QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs& config) const {
+    QueryNetworkResult qr;
+
+    for (auto&& deviceResult : QueryDevices(network, config)) {
+        for (auto&& layerQueryResult : deviceResult.second.supportedLayersMap) {
             qr.supportedLayersMap.emplace(layerQueryResult);
         }
     }
@@ -219,6 +234,15 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return {dump};
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PIPELINE));
+        IE_ASSERT(it != _config.end());
+        bool pipeline = it->second == YES;
+        return {pipeline};
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING) || name == HETERO_CONFIG_KEY(NODE_COSTS)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        return {it->second};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities.name()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
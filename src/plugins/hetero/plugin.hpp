@@ -46,6 +46,11 @@ public:
 
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback, const Configs& localConfig) const;
 
+    // Queries the network on every device of the priorities list, the results go in the priority order
+    std::vector<std::pair<std::string, InferenceEngine::QueryNetworkResult>> QueryDevices(
+        const InferenceEngine::CNNNetwork& network,
+        const Configs& config) const;
+
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string& deviceName) const;
     std::string DeviceArchitecture(const std::string& targetFallback) const;
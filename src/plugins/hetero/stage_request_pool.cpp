@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "stage_request_pool.hpp"
+
+#include <ie_plugin_config.hpp>
+#include <utility>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+StageRequestPool::StageRequestPool(const SoExecutableNetworkInternal& network, std::size_t size) {
+    for (std::size_t id = 0; id < size; ++id) {
+        SoIInferRequestInternal request = {network->CreateInferRequest(), network._so};
+        request->setModelInputsOutputs(network->getInputs(), network->getOutputs());
+        _requests.push_back(request);
+        _freeRequests.push_back(id);
+    }
+    try {
+        _collectPerfCounters =
+            network->GetConfig(CONFIG_KEY(PERF_COUNT)).as<std::string>() == PluginConfigParams::YES;
+    } catch (...) {
+        // the device doesn't report the PERF_COUNT config, so the counters are never collected
+    }
+}
+
+void StageRequestPool::Acquire(AcquiredTask task) {
+    std::size_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_freeRequests.empty()) {
+            _waitingTasks.push_back(std::move(task));
+            return;
+        }
+        id = _freeRequests.front();
+        _freeRequests.pop_front();
+    }
+    task(id);
+}
+
+void StageRequestPool::Release(std::size_t id) {
+    AcquiredTask task;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_waitingTasks.empty()) {
+            _freeRequests.push_back(id);
+            return;
+        }
+        task = std::move(_waitingTasks.front());
+        _waitingTasks.pop_front();
+    }
+    task(id);
+}
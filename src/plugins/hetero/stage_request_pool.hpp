@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Pool of the infer requests of one subnetwork shared by all the HETERO infer requests in the pipelined mode.
+ * The HETERO requests waiting for a free subnetwork request are queued in the FIFO order, so the stage never runs
+ * more requests than the pool size and the queue in front of the stage is bounded by the number of the HETERO requests.
+ */
+class StageRequestPool {
+public:
+    using Ptr = std::shared_ptr<StageRequestPool>;
+    using AcquiredTask = std::function<void(std::size_t)>;
+
+    StageRequestPool(const InferenceEngine::SoExecutableNetworkInternal& network, std::size_t size);
+
+    /**
+     * @brief Runs the task with the id of the free request immediately or, if all the requests are busy,
+     * in the thread releasing the request
+     */
+    void Acquire(AcquiredTask task);
+
+    void Release(std::size_t id);
+
+    InferenceEngine::SoIInferRequestInternal& Get(std::size_t id) {
+        return _requests.at(id);
+    }
+
+    bool CollectsPerfCounters() const {
+        return _collectPerfCounters;
+    }
+
+private:
+    std::vector<InferenceEngine::SoIInferRequestInternal> _requests;
+    bool _collectPerfCounters = false;
+    std::mutex _mutex;
+    std::deque<std::size_t> _freeRequests;
+    std::deque<AcquiredTask> _waitingTasks;
+};
+
+}  // namespace HeteroPlugin
@@ -148,6 +148,26 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES == key) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PERF_COUNT_HISTOGRAMS == key) {
+            if (val == PluginConfigParams::YES) collectPerfHistograms = true;
+            else if (val == PluginConfigParams::NO) collectPerfHistograms = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PERF_COUNT_HISTOGRAMS
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_TRACE == key) {
+            if (val == PluginConfigParams::YES) collectTrace = true;
+            else if (val == PluginConfigParams::NO) collectTrace = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_TRACE
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_SHARED_WEIGHTS_DIR == key) {
+            sharedWeightsDir = val;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -159,6 +179,10 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
     if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
         streamExecutorConfig._streams = 1;
 
+    // the histograms are filled by the perf counters
+    if (collectPerfHistograms)
+        collectPerfCounters = true;
+
     CPU_DEBUG_CAP_ENABLE(readDebugCapsProperties());
     updateProperties();
 }
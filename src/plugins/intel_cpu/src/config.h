@@ -23,11 +23,15 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    bool collectPerfHistograms = false;
+    bool collectTrace = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    bool parallelBranches = false;
+    std::string sharedWeightsDir = "";
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
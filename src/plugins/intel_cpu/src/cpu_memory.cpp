@@ -17,6 +17,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/reorder.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/numa_memory.hpp"
 
 using namespace InferenceEngine;
 using namespace mkldnn;
@@ -136,10 +137,13 @@ DnnlMemoryDescPtr MKLDNNMemory::GetDescWithType<DnnlMemoryDesc, 0, 0>() const {
     return MemoryDescUtils::convertToDnnlMemoryDesc(pMemDesc);
 }
 
-void MKLDNNMemory::setDataHandle(void *data) {
+void MKLDNNMemory::setDataHandle(void *data, bool pads_zeroing) {
     size_t maxMemSize = pMemDesc->hasDefinedMaxSize() ?  pMemDesc->getMaxMemSize() : 0;
     mgrHandle->setExtBuff(data, maxMemSize);
-    prim->set_data_handle(mgrHandle->getRawPtr()); // for pads zeroing, to preserve mkldnn::memory::set_data_handle behaviour
+    if (pads_zeroing)
+        prim->set_data_handle(mgrHandle->getRawPtr()); // for pads zeroing, to preserve mkldnn::memory::set_data_handle behaviour
+    else
+        prim->set_data_handle_no_pads_proc(mgrHandle->getRawPtr());
 }
 
 void MKLDNNMemory::update() {
@@ -178,13 +182,18 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
+        // the memory of the graph is local to the NUMA node of the stream which owns the graph
+        const int numaNode = NumaNodeScope::current();
+        void *ptr = numaNode >= 0 ? allocNumaMemory(size, {numaNode}) : dnnl::impl::malloc(size, cacheLineSize);
         if (!ptr) {
             throw std::bad_alloc();
         }
         _memUpperBound = size;
         _useExternalStorage = false;
-        _data = decltype(_data)(ptr, destroy);
+        if (numaNode >= 0)
+            _data = decltype(_data)(ptr, [size](void *data) { freeNumaMemory(data, size); });
+        else
+            _data = decltype(_data)(ptr, destroy);
         sizeChanged = true;
     }
     return sizeChanged;
@@ -84,7 +84,8 @@ public:
 private:
     bool _useExternalStorage = false;
     size_t _memUpperBound = 0ul;
-    std::unique_ptr<void, void (*)(void *)> _data;
+    // the deleter of the NUMA bound memory keeps the size of the allocation
+    std::unique_ptr<void, std::function<void(void *)>> _data;
 
     static void release(void *ptr);
     static void destroy(void *ptr);
@@ -177,7 +178,7 @@ public:
         return prim != nullptr;
     }
 
-    void setDataHandle(void* data);
+    void setDataHandle(void* data, bool pads_zeroing = true);
 
     const MemoryDesc& getDesc() const {
         return *pMemDesc;
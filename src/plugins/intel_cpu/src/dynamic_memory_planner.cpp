@@ -0,0 +1,220 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_memory_planner.h"
+#include "node.h"
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "utils/general_utils.h"
+#include "memory_solver.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr int64_t alignment = 32;  // 32 bytes, the same as for the static memory planning
+
+size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value)
+        result <<= 1;
+    return value == 0 ? 0 : result;
+}
+
+// The memory of these edges is exposed to the user or kept between the inferences
+bool isPlannable(const MKLDNNEdgePtr& edge) {
+    const auto& parent = edge->getParent();
+    const auto& child = edge->getChild();
+    return !parent->isConstant() &&
+           !one_of(parent->getType(), Input, MemoryInput) &&
+           !one_of(child->getType(), Output, MemoryOutput);
+}
+}   // namespace
+
+DynamicMemoryPlanner::BucketKey DynamicMemoryPlanner::makeBucketKey(const std::vector<VectorDims>& dims) {
+    BucketKey key(dims);
+    for (auto& shape : key) {
+        for (auto& dim : shape)
+            dim = roundUpToPowerOfTwo(dim);
+    }
+    return key;
+}
+
+void DynamicMemoryPlanner::init(const std::vector<MKLDNNEdgePtr>& graphEdges) {
+    reset();
+
+    std::unordered_map<const MKLDNNEdge*, size_t> clusterIdx;
+    for (auto& edge : graphEdges) {
+        if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
+            clusterIdx.emplace(edge.get(), clusters.size());
+            clusters.push_back({{edge}, nullptr, std::numeric_limits<int>::max(), 0});
+        }
+    }
+    for (auto& edge : graphEdges) {
+        if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation)
+            continue;
+        auto base = edge->getSharedEdge(std::nothrow);
+        for (auto shared = base; shared; shared = shared->getSharedEdge(std::nothrow))
+            base = shared;
+        if (!base)
+            continue;
+        auto it = clusterIdx.find(base.get());
+        if (it != clusterIdx.end())
+            clusters[it->second].edges.push_back(edge);
+    }
+
+    std::vector<Cluster> plannable;
+    for (auto& cluster : clusters) {
+        if (!std::all_of(cluster.edges.begin(), cluster.edges.end(), isPlannable))
+            continue;
+        for (auto& edge : cluster.edges) {
+            cluster.start = std::min(cluster.start, edge->getParent()->getExecIndex());
+            cluster.finish = std::max(cluster.finish, edge->getChild()->getExecIndex());
+        }
+        plannable.push_back(std::move(cluster));
+    }
+    clusters = std::move(plannable);
+}
+
+void DynamicMemoryPlanner::bind() {
+    std::vector<Cluster> bound;
+    for (auto& cluster : clusters) {
+        cluster.mngr = cluster.edges.front()->getMemory().getDnnlMemoryMngr();
+        const bool sameMngr = std::all_of(cluster.edges.begin(), cluster.edges.end(), [&](const MKLDNNEdgePtr& edge) {
+            return edge->getMemory().getDnnlMemoryMngr() == cluster.mngr;
+        });
+        if (sameMngr)
+            bound.push_back(std::move(cluster));
+    }
+    clusters = std::move(bound);
+}
+
+void DynamicMemoryPlanner::reset() {
+    clusters.clear();
+    {
+        std::lock_guard<std::mutex> lock(plansMutex);
+        plans.clear();
+    }
+    currentKey.clear();
+    appliedKey.clear();
+    appliedVersion = 0;
+    arena.reset();
+}
+
+size_t DynamicMemoryPlanner::getCurrentSize(const Cluster& cluster) const {
+    size_t size = 0;
+    for (auto& edge : cluster.edges) {
+        const auto& desc = edge->getMemory().getDesc();
+        if (desc.isDefined())
+            size = std::max(size, desc.getCurrentMemSize());
+    }
+    return size;
+}
+
+void DynamicMemoryPlanner::solve(Plan& plan) const {
+    std::vector<MemorySolver::Box> boxes(clusters.size());
+    for (size_t i = 0; i < clusters.size(); i++) {
+        const int64_t size = std::max<int64_t>(div_up(plan.sizes[i], alignment), 1);
+        boxes[i] = {clusters[i].start, clusters[i].finish, size, static_cast<int64_t>(i)};
+    }
+
+    MemorySolver memSolver(boxes);
+    plan.total = static_cast<size_t>(memSolver.solve()) * alignment;
+    plan.offsets.resize(clusters.size());
+    for (size_t i = 0; i < clusters.size(); i++)
+        plan.offsets[i] = static_cast<size_t>(memSolver.getOffset(static_cast<int>(i))) * alignment;
+    plan.version++;
+}
+
+void DynamicMemoryPlanner::apply(const Plan& plan) {
+    auto newArena = arena;
+    if (!arena || arena->GetSize() < plan.total) {
+        newArena = std::make_shared<MKLDNNMemory>(clusters.front().edges.front()->getParent()->getEngine());
+        newArena->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(VectorDims{plan.total})));
+    }
+
+    auto* arenaPtr = static_cast<uint8_t*>(newArena->GetData());
+    for (size_t i = 0; i < clusters.size(); i++) {
+        clusters[i].mngr->setExtBuff(arenaPtr + plan.offsets[i], plan.sizes[i]);
+    }
+
+    // the old arena is released only when no cluster points to it anymore
+    arena = newArena;
+}
+
+void DynamicMemoryPlanner::prepare(const BucketKey& key) {
+    if (clusters.empty())
+        return;
+
+    currentKey = key;
+    auto it = plans.find(currentKey);
+    if (it == plans.end() || it->second.version == 0)
+        return;
+
+    const auto& plan = it->second;
+    if (appliedKey == currentKey && appliedVersion == plan.version)
+        return;
+
+    // The nodes which input shapes are not changed since the previous inference won't redefine the memory,
+    // so the layout must also fit the current sizes of the clusters
+    Plan layout = plan;
+    bool grown = false;
+    for (size_t i = 0; i < clusters.size(); i++) {
+        const auto size = getCurrentSize(clusters[i]);
+        if (size > layout.sizes[i]) {
+            layout.sizes[i] = size;
+            grown = true;
+        }
+    }
+    if (grown)
+        solve(layout);
+
+    apply(layout);
+    appliedKey = currentKey;
+    appliedVersion = plan.version;
+}
+
+void DynamicMemoryPlanner::finalize() {
+    if (clusters.empty())
+        return;
+
+    std::lock_guard<std::mutex> lock(plansMutex);
+    auto& plan = plans[currentKey];
+    plan.sizes.resize(clusters.size(), 0);
+
+    bool grown = false;
+    for (size_t i = 0; i < clusters.size(); i++) {
+        const auto size = getCurrentSize(clusters[i]);
+        if (size > plan.sizes[i]) {
+            plan.sizes[i] = size;
+            grown = true;
+        }
+    }
+
+    if (grown)
+        solve(plan);
+}
+
+std::map<std::string, uint64_t> DynamicMemoryPlanner::getPeakMemory() const {
+    std::map<std::string, uint64_t> result;
+    std::lock_guard<std::mutex> lock(plansMutex);
+    for (const auto& plan : plans) {
+        std::stringstream bucket;
+        for (size_t i = 0; i < plan.first.size(); i++) {
+            if (i != 0)
+                bucket << ",";
+            for (size_t j = 0; j < plan.first[i].size(); j++)
+                bucket << (j != 0 ? "x" : "") << plan.first[i][j];
+        }
+        result[bucket.str()] = plan.second.total;
+    }
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,90 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "edge.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Runtime memory planner for the edges which sizes are unknown until the inference (dynamic shapes).
+ * Such edges are not handled by the MemorySolver on the graph allocation stage, so by default each of them owns
+ * a separately growing buffer. The planner groups the inferences into buckets by the input shapes (each dimension
+ * rounded up to a power of two), records the sizes of the dynamic edge clusters seen within the bucket, packs them
+ * with the MemorySolver and places the clusters into the single arena shared by all the buckets.
+ *
+ * The first inference of a bucket keeps the current memory placement and is used to collect the sizes.
+ * A cluster which grows beyond the planned size within the bucket falls back to the individual allocation
+ * (MemoryMngrWithReuse::resize) and the bucket is replanned after the inference. The arena only grows, so
+ * switching between the known buckets does not allocate memory.
+ */
+class DynamicMemoryPlanner {
+public:
+    using BucketKey = std::vector<VectorDims>;
+
+    /**
+     * Collects the clusters of the edges which still need allocation after the static memory planning.
+     * Must be called before the remaining edges are allocated, since the allocation resets the sharing chains.
+     */
+    void init(const std::vector<MKLDNNEdgePtr>& graphEdges);
+    // Looks up the memory managers of the clusters, must be called when all the edges are allocated
+    void bind();
+    void reset();
+
+    bool empty() const {
+        return clusters.empty();
+    }
+
+    // Places the clusters according to the plan of the bucket (if known) before the inference
+    void prepare(const BucketKey& key);
+    // Updates the plan of the current bucket with the sizes of the clusters after the inference
+    void finalize();
+
+    // packed memory size in bytes per bucket, the key is the bucket dims joined as "1x64x128,1x16"
+    // may be called concurrently with the inference (e.g. by the metric request from another thread)
+    std::map<std::string, uint64_t> getPeakMemory() const;
+
+    static BucketKey makeBucketKey(const std::vector<VectorDims>& dims);
+
+private:
+    struct Cluster {
+        std::vector<MKLDNNEdgePtr> edges;
+        DnnlMemoryMngrPtr mngr;
+        int start;
+        int finish;
+    };
+
+    struct Plan {
+        std::vector<size_t> sizes;    // max size seen per cluster in bytes
+        std::vector<size_t> offsets;  // offset per cluster in bytes
+        size_t total = 0;
+        size_t version = 0;           // incremented on each solve to detect the outdated placement
+    };
+
+    size_t getCurrentSize(const Cluster& cluster) const;
+    void solve(Plan& plan) const;
+    void apply(const Plan& plan);
+
+    std::vector<Cluster> clusters;
+    std::map<BucketKey, Plan> plans;
+    // guards the modifications of the plans against the concurrent getPeakMemory() calls,
+    // the reads within the inference thread don't need it
+    mutable std::mutex plansMutex;
+
+    BucketKey currentKey;
+    BucketKey appliedKey;
+    size_t appliedVersion = 0;
+    MKLDNNMemoryPtr arena;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -6,8 +6,12 @@
 
 #include <ngraph/rt_info.hpp>
 #include <ngraph/variant.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ie_ngraph_utils.hpp>
 
 #include "jit_emitter.hpp"
+#include "jit_load_store_emitters.hpp"
+#include "snippets/op/subgraph.hpp"
 
 using namespace Xbyak;
 
@@ -21,6 +25,10 @@ namespace intel_cpu {
 struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    // work amounts and offsets of the shape agnostic kernel, ignored if the kernel is compiled for static shapes
+    int64_t scheduler_dims[SNIPPETS_MAX_TILE_RANK] = {};
+    int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
 };
 
 struct jit_snippets_compile_args {
@@ -28,6 +36,9 @@ struct jit_snippets_compile_args {
     int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
     std::vector<size_t> output_dims = {};
+    // if set, scheduler dims and offsets above are not used and the kernel reads them from jit_snippets_call_args,
+    // so the same code serves any shapes with the same broadcasting pattern
+    bool runtime_schedule = false;
 };
 ///
 /// \brief    Kernel is the only entry point to Codogen Jit compilation. Kernel calculates appropriate data offsets,
@@ -120,13 +131,23 @@ private:
                 }
             }
         };
+        auto init_ptrs_with_runtime_offsets = [&](Reg64 pointer, size_t offsets_idx) {
+            for (int j = 0; j < harness_num_dims; j++) {
+                h->mov(reg_tmp_64, h->ptr[reg_const_params + GET_OFF(data_offsets) + (offsets_idx + j) * sizeof(int64_t)]);
+                h->imul(reg_tmp_64, h->ptr[reg_indexes + j * sizeof(size_t)]);
+                h->add(pointer, reg_tmp_64);
+            }
+        };
         for (auto i = 0; i < num_params; i++) {
             regs[i] = Reg64(reg64_tmp_start + i);
             if (i < num_inputs)
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
             else
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
-            init_ptrs_with_offsets(regs[i], &jcp.data_offsets[i * harness_num_dims]);
+            if (jcp.runtime_schedule)
+                init_ptrs_with_runtime_offsets(regs[i], i * harness_num_dims);
+            else
+                init_ptrs_with_offsets(regs[i], &jcp.data_offsets[i * harness_num_dims]);
         }
 
         for (auto& c : code) {
@@ -150,6 +171,8 @@ private:
 /// So previous_inc is zero for outer and vector tiles (the are the first in dim) and vlen for scalar tiles (they usually go after vector Tiles).
 /// \param      in[2]    sum number inputs and number of outputs of the node.
 /// \param      in[3]    dimension of the tile. Note that only 2d Tile are currently supported, so dim is 0 for outer tiles, 1 for inner tiles.
+/// \param      in[4..]  optional, one per param: element size in bytes to rewind the param pointer by the whole inner dimension
+/// after the tile. Used by the inner tiles if the same row is read again by the following tiles (reductions).
 ///
 // Todo: Inner and outer tiles have different semantics. For example, outer tile always has the increment == 1, and it can contain only
 //  tile emitters (one outer or two inner). So it seems better to create different classes for inner and outer tiles.
@@ -180,8 +203,8 @@ public:
 private:
     void validate_arguments(const std::vector<size_t> &in, const std::vector<size_t> &out,
                             const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override {
-        if (in.size() != 4)
-            IE_THROW() << "TileEmitter got invalid number of inputs. Expected 4, got " << in.size();
+        if (in.size() < 4)
+            IE_THROW() << "TileEmitter got invalid number of inputs. Expected at least 4, got " << in.size();
         if (out.size() != 0)
             IE_THROW() << "TileEmitter got unexpected output arguments.";
         const size_t num_params = in[2];
@@ -192,6 +215,10 @@ private:
         if (dim >= SNIPPETS_MAX_TILE_RANK)
             IE_THROW() << "TileEmitter supports tile ranks up to " << SNIPPETS_MAX_TILE_RANK <<
                        " got " << dim;
+        if (in.size() != 4 && in.size() != 4 + num_params)
+            IE_THROW() << "TileEmitter got invalid number of inputs. Expected 4 or " << 4 + num_params << ", got " << in.size();
+        if (in.size() != 4 && dim != 1)
+            IE_THROW() << "TileEmitter supports pointer rewinds only for inner tiles";
     }
 
     void emit_impl(const std::vector<size_t>& in,
@@ -205,7 +232,6 @@ private:
         const size_t dim = in[3]; // tile dimension: 0 - outer, 1 - inner
         const int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
         Reg64 amount = Reg64(reg64_tmp_start + num_params); // amount
-        std::array<Label, 2> for_body;
 
         // If R15 is not used, reserve it for use in scalar to avoid redundant push-pop's.
         // todo: Do we need explicitly check that code contains ScalarEmitter?
@@ -213,6 +239,31 @@ private:
         std::vector<Reg64> regs(num_params);
         for (auto i = 0; dim == 0 && i < num_params; i++)
             regs[i] = Reg64(reg64_tmp_start + i);
+        if (jcp.runtime_schedule)
+            emit_runtime_loop(inc, previous_inc, num_params, dim, amount, regs, pool, local_gpr);
+        else
+            emit_static_loop(inc, previous_inc, num_params, dim, amount, regs, pool, local_gpr);
+
+        // The whole row has been processed by this and the previous tiles, so the pointers are moved back to the row start
+        for (size_t i = 0; i + 4 < in.size(); i++) {
+            const size_t data_size = in[4 + i];
+            if (data_size == 0)
+                continue;
+            Reg64 reg = Reg64(reg64_tmp_start + i);
+            if (jcp.runtime_schedule) {
+                Reg64 reg_const_params { dnnl::impl::cpu::x64::abi_param2 };
+                h->mov(amount, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + dim * sizeof(int64_t)]);
+                h->imul(amount, amount, data_size);
+                h->sub(reg, amount);
+            } else {
+                h->sub(reg, jcp.scheduler_dims[dim] * data_size);
+            }
+        }
+    }
+
+    void emit_static_loop(size_t inc, size_t previous_inc, size_t num_params, size_t dim, const Reg64& amount,
+                          const std::vector<Reg64>& regs, const std::vector<size_t>& pool, const std::vector<size_t>& local_gpr) const {
+        std::array<Label, 2> for_body;
         // Loop processing could be simplified in some cases
         if (inc > jcp.scheduler_dims[dim]) {
             return;
@@ -255,6 +306,37 @@ private:
         }
     }
 
+    // The same loop as above, but the work amount and the pointer increments are read from jit_snippets_call_args
+    // (the pointer to which is kept in abi_param2 by the Kernel), so nothing can be resolved at the compile time.
+    // If the previous tile in the same dim exists, the work amount left by it is processed.
+    void emit_runtime_loop(size_t inc, size_t previous_inc, size_t num_params, size_t dim, const Reg64& amount,
+                           const std::vector<Reg64>& regs, const std::vector<size_t>& pool, const std::vector<size_t>& gpr) const {
+        Reg64 reg_const_params { dnnl::impl::cpu::x64::abi_param2 };
+        std::array<Label, 2> for_body;
+
+        if (previous_inc == 0)
+            h->mov(amount, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + dim * sizeof(int64_t)]);
+        h->cmp(amount, inc);
+        h->jl(for_body[0], CodeGenerator::T_NEAR);
+
+        h->L(for_body[1]);
+        {
+            h->push(amount);
+            for (auto& c : code) {
+                c.first->emit_code(c.second.first, c.second.second, pool, gpr);
+            }
+            h->pop(amount);
+            for (auto i = 0; dim == 0 && i < num_params; i++) {
+                h->add(regs[i], h->ptr[reg_const_params + GET_OFF(scheduler_offsets) + i * sizeof(int64_t)]);
+            }
+            h->sub(amount, inc);
+            h->cmp(amount, inc);
+            h->jge(for_body[1], CodeGenerator::T_NEAR);
+        }
+
+        h->L(for_body[0]);
+    }
+
     // A = <42, 17>
     // B = < 1, 17>
     // for (auto k = 0; k < dom_0; k++) { // 42
@@ -404,6 +486,145 @@ private:
     int32_t value;
 };
 
+///
+/// Reduction emitters:
+///
+/// *Note*: the output register of Reduce is the accumulator, which is reserved for the whole kernel by AssignRegisters.
+/// It's initialized by the Scalar emitter before the inner tiles, and HorizonReduce leaves the reduced value
+/// in all the lanes after them, so the consumers may use it as a broadcasted value.
+class ReduceEmitter : public jit_emitter {
+public:
+    ReduceEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto reduce = ov::as_type_ptr<ngraph::snippets::op::Reduce>(n);
+        if (!reduce)
+            IE_THROW() << "ReduceEmitter invoked with invalid op argument";
+        type = reduce->get_reduce_type();
+        // only the first lane is valid in case of scalar loads
+        is_scalar = ov::is_type<ngraph::snippets::op::ScalarReduce>(n);
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        if (is_scalar) {
+            Xmm xmm_src = Xmm(in[0]);
+            Xmm xmm_acc = Xmm(out[0]);
+            if (isa == dnnl::impl::cpu::x64::sse41) {
+                if (type == ngraph::snippets::op::Reduce::Type::Sum)
+                    h->addss(xmm_acc, xmm_src);
+                else
+                    h->maxss(xmm_acc, xmm_src);
+            } else {
+                if (type == ngraph::snippets::op::Reduce::Type::Sum)
+                    h->vaddss(xmm_acc, xmm_acc, xmm_src);
+                else
+                    h->vmaxss(xmm_acc, xmm_acc, xmm_src);
+            }
+        } else {
+            Vmm vmm_src = Vmm(in[0]);
+            Vmm vmm_acc = Vmm(out[0]);
+            if (type == ngraph::snippets::op::Reduce::Type::Sum)
+                h->uni_vaddps(vmm_acc, vmm_acc, vmm_src);
+            else
+                h->uni_vmaxps(vmm_acc, vmm_acc, vmm_src);
+        }
+    }
+
+private:
+    ngraph::snippets::op::Reduce::Type type;
+    bool is_scalar;
+};
+
+class HorizonReduceEmitter : public jit_emitter {
+public:
+    HorizonReduceEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto horizon = ov::as_type_ptr<ngraph::snippets::op::HorizonReduce>(n);
+        if (!horizon)
+            IE_THROW() << "HorizonReduceEmitter invoked with invalid op argument";
+        type = horizon->get_reduce_type();
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Xmm xmm_src = Xmm(in[0]);
+        Xmm xmm_aux = Xmm(aux_vec_idxs[0]);
+        Vmm vmm_dst = Vmm(out[0]);
+
+        if (isa == dnnl::impl::cpu::x64::avx512_common) {
+            h->vextractf64x4(Ymm(aux_vec_idxs[0]), Zmm(in[0]), 1);
+            horiz_ps(Ymm(in[0]), Ymm(aux_vec_idxs[0]));
+        }
+        if (isa != dnnl::impl::cpu::x64::sse41) {
+            h->vextractf128(xmm_aux, Ymm(in[0]), 1);
+            horiz_ps(xmm_src, xmm_aux);
+        }
+        h->uni_vmovshdup(xmm_aux, xmm_src);          // src:1,2,3,4; aux:2,2,4,4
+        horiz_ps(xmm_src, xmm_aux);                  // src:f(1,2),f(2,2),f(3,4),f(4,4)
+        h->uni_vmovhlps(xmm_aux, xmm_aux, xmm_src);  // aux:f(3,4),f(4,4),4,4
+        horiz_ps(xmm_src, xmm_aux);                  // src:f(1,2,3,4),...
+        h->uni_vbroadcastss(vmm_dst, xmm_src);
+    }
+
+    template <typename Vmm>
+    void horiz_ps(const Vmm& vmm, const Vmm& vmm_aux) const {
+        if (type == ngraph::snippets::op::Reduce::Type::Sum)
+            h->uni_vaddps(vmm, vmm, vmm_aux);
+        else
+            h->uni_vmaxps(vmm, vmm, vmm_aux);
+    }
+
+private:
+    ngraph::snippets::op::Reduce::Type type;
+};
+
 ///
 /// Memory emitters:
 ///
@@ -434,17 +655,44 @@ protected:
         return ea;
     }
 
+    // The data in memory may be stored in the low precision (bf16, i8, u8) while the snippet is executed in fp32,
+    // the conversion is performed in registers by the common load/store emitters
+    static auto getLoadPrecision(const std::shared_ptr<ov::Node>& n) -> InferenceEngine::Precision {
+        return InferenceEngine::details::convertPrecision(
+            ngraph::snippets::op::Subgraph::get_memory_precision(n->get_input_node_shared_ptr(0)));
+    }
+
+    static auto getStorePrecision(const std::shared_ptr<ov::Node>& n) -> InferenceEngine::Precision {
+        for (const auto& consumer : n->get_output_target_inputs(0)) {
+            const auto result = consumer.get_node()->shared_from_this();
+            if (ov::is_type<ngraph::opset1::Result>(result))
+                return InferenceEngine::details::convertPrecision(ngraph::snippets::op::Subgraph::get_memory_precision(result));
+        }
+        return InferenceEngine::Precision::FP32;
+    }
+
     size_t ea;
 };
 
 class StoreEmitter : public MemoryEmitter  {
 public:
     StoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n) {
+    : MemoryEmitter(h, isa, n), prc(getStorePrecision(n)) {
+        if (prc != InferenceEngine::Precision::FP32)
+            store_emitter.reset(new jit_store_emitter(h, isa));
     }
 
     size_t get_inputs_num() const override {return 1;}
 
+    void emit_data() const override {
+        if (store_emitter)
+            store_emitter->emit_data();
+    }
+
+protected:
+    // the common store emitter converts the source register in place and needs the zeroed one
+    size_t aux_vecs_count() const override {return store_emitter ? 2 : 0;}
+
 private:
     void emit_impl(const std::vector<size_t>& in,
               const std::vector<size_t>& out,
@@ -452,11 +700,11 @@ private:
               const std::vector<size_t>& gpr,
               const ov::intel_cpu::emitter_context *emit_context) const override {
         if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
-            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out, gpr);
         } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
-            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out, gpr);
         } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
-            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out, gpr);
         } else {
             IE_THROW() << host_isa_;
             assert(!"unsupported isa");
@@ -464,24 +712,49 @@ private:
     }
 
     template <dnnl::impl::cpu::x64::cpu_isa_t isa>
-    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out, const std::vector<size_t> &gpr) const {
         using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
                                     Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 out_reg(ea);
         Vmm vmm_src0 = Vmm(in[0]);
-        h->uni_vmovups(h->ptr[out_reg], vmm_src0);
-        h->add(out_reg, mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
+        if (store_emitter) {
+            const size_t lanes = mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float);
+            Vmm vmm_tmp = Vmm(aux_vec_idxs[0]);
+            Vmm vmm_zero = Vmm(aux_vec_idxs[1]);
+            h->uni_vmovups(vmm_tmp, vmm_src0);
+            h->uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+            store_emitter->emit_code({aux_vec_idxs[0]}, {ea},
+                                     std::make_shared<store_emitter_context>(InferenceEngine::Precision::FP32, prc, lanes),
+                                     {aux_vec_idxs[1]}, gpr);
+            h->add(out_reg, lanes * prc.size());
+        } else {
+            h->uni_vmovups(h->ptr[out_reg], vmm_src0);
+            h->add(out_reg, mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
+        }
     }
+
+    InferenceEngine::Precision prc;
+    std::shared_ptr<jit_store_emitter> store_emitter;
 };
 
 class ScalarStoreEmitter : public MemoryEmitter {
 public:
     ScalarStoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n) {
+    : MemoryEmitter(h, isa, n), prc(getStorePrecision(n)) {
+        if (prc != InferenceEngine::Precision::FP32)
+            store_emitter.reset(new jit_store_emitter(h, isa));
     }
 
     size_t get_inputs_num() const override {return 1;}
 
+    void emit_data() const override {
+        if (store_emitter)
+            store_emitter->emit_data();
+    }
+
+protected:
+    size_t aux_vecs_count() const override {return store_emitter ? 2 : 0;}
+
 private:
     void emit_impl(const std::vector<size_t>& in,
               const std::vector<size_t>& out,
@@ -489,11 +762,11 @@ private:
               const std::vector<size_t>& gpr,
               const ov::intel_cpu::emitter_context *emit_context) const override {
         if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
-            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out, gpr);
         } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
-            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out, gpr);
         } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
-            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out, gpr);
         } else {
             IE_THROW() << host_isa_;
             assert(!"unsupported isa");
@@ -501,24 +774,44 @@ private:
     }
 
     template <dnnl::impl::cpu::x64::cpu_isa_t isa>
-    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out, const std::vector<size_t> &gpr) const {
         using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
                                         Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 out_reg(ea);
         Xmm vmm_src0 = Xmm(in[0]);
-        h->uni_vmovss(h->ptr[out_reg], vmm_src0);
-        h->add(out_reg, sizeof(float));
+        if (store_emitter) {
+            Vmm vmm_zero = Vmm(aux_vec_idxs[1]);
+            h->uni_vmovss(Xmm(aux_vec_idxs[0]), vmm_src0);
+            h->uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+            store_emitter->emit_code({aux_vec_idxs[0]}, {ea},
+                                     std::make_shared<store_emitter_context>(InferenceEngine::Precision::FP32, prc, 1),
+                                     {aux_vec_idxs[1]}, gpr);
+            h->add(out_reg, prc.size());
+        } else {
+            h->uni_vmovss(h->ptr[out_reg], vmm_src0);
+            h->add(out_reg, sizeof(float));
+        }
     }
+
+    InferenceEngine::Precision prc;
+    std::shared_ptr<jit_store_emitter> store_emitter;
 };
 
 class LoadEmitter : public MemoryEmitter {
 public:
     LoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1) {
+    : MemoryEmitter(h, isa, n), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1), prc(getLoadPrecision(n)) {
+        if (prc != InferenceEngine::Precision::FP32)
+            load_emitter.reset(new jit_load_emitter(h, isa));
     }
 
     size_t get_inputs_num() const override {return 0;}
 
+    void emit_data() const override {
+        if (load_emitter)
+            load_emitter->emit_data();
+    }
+
 private:
     void emit_impl(const std::vector<size_t>& in,
               const std::vector<size_t>& out,
@@ -526,11 +819,11 @@ private:
               const std::vector<size_t>& gpr,
               const ov::intel_cpu::emitter_context *emit_context) const override {
         if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
-            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out, gpr);
         } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
-            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out, gpr);
         } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
-            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out, gpr);
         } else {
             IE_THROW() << host_isa_;
             assert(!"unsupported isa");
@@ -538,29 +831,45 @@ private:
     }
 
     template <dnnl::impl::cpu::x64::cpu_isa_t isa>
-    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out, const std::vector<size_t> &gpr) const {
         using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
                                             Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 in_reg(ea);
         Vmm vmm_src0 = Vmm(out[0]);
-        h->uni_vmovups(vmm_src0, h->ptr[in_reg]);
+        const size_t lanes = mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float);
+        if (load_emitter) {
+            load_emitter->emit_code({ea}, {out[0]},
+                                    std::make_shared<load_emitter_context>(prc, InferenceEngine::Precision::FP32, lanes),
+                                    {}, gpr);
+        } else {
+            h->uni_vmovups(vmm_src0, h->ptr[in_reg]);
+        }
 
         if (shouldPostIncrement) {
-            h->add(in_reg, mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
+            h->add(in_reg, lanes * prc.size());
         }
     }
 
 private:
     bool shouldPostIncrement;
+    InferenceEngine::Precision prc;
+    std::shared_ptr<jit_load_emitter> load_emitter;
 };
 
 class BroadcastLoadEmitter : public MemoryEmitter {
 public:
     BroadcastLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n) {
+    : MemoryEmitter(h, isa, n), prc(getLoadPrecision(n)) {
+        if (prc != InferenceEngine::Precision::FP32)
+            load_emitter.reset(new jit_load_emitter(h, isa));
     }
     size_t get_inputs_num() const override {return 0;}
 
+    void emit_data() const override {
+        if (load_emitter)
+            load_emitter->emit_data();
+    }
+
 private:
     void emit_impl(const std::vector<size_t>& in,
               const std::vector<size_t>& out,
@@ -568,11 +877,11 @@ private:
               const std::vector<size_t>& gpr,
               const ov::intel_cpu::emitter_context *emit_context) const override {
         if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
-            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out, gpr);
         } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
-            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out, gpr);
         } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
-            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out, gpr);
         } else {
             IE_THROW() << host_isa_;
             assert(!"unsupported isa");
@@ -580,7 +889,7 @@ private:
     }
 
     template <dnnl::impl::cpu::x64::cpu_isa_t isa>
-    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out, const std::vector<size_t> &gpr) const {
         using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
                                             Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 in_reg(ea);
@@ -588,17 +897,35 @@ private:
 
         // In doesn't really matter if we broadcast or `movss` for vector tails so keep only one version for `BroadcastLoad`,
         // key point here is not to add post-increment, it might be fixed by some other approach in future
-        h->uni_vbroadcastss(vmm_src0, h->ptr[in_reg]);
+        if (load_emitter) {
+            load_emitter->emit_code({ea}, {out[0]},
+                                    std::make_shared<load_emitter_context>(prc, InferenceEngine::Precision::FP32, 1),
+                                    {}, gpr);
+            h->uni_vbroadcastss(vmm_src0, Xmm(out[0]));
+        } else {
+            h->uni_vbroadcastss(vmm_src0, h->ptr[in_reg]);
+        }
     }
+
+private:
+    InferenceEngine::Precision prc;
+    std::shared_ptr<jit_load_emitter> load_emitter;
 };
 
 class ScalarLoadEmitter : public MemoryEmitter {
 public:
     ScalarLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1) {
+    : MemoryEmitter(h, isa, n), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1), prc(getLoadPrecision(n)) {
+        if (prc != InferenceEngine::Precision::FP32)
+            load_emitter.reset(new jit_load_emitter(h, isa));
     }
     size_t get_inputs_num() const override {return 0;}
 
+    void emit_data() const override {
+        if (load_emitter)
+            load_emitter->emit_data();
+    }
+
 private:
     void emit_impl(const std::vector<size_t>& in,
               const std::vector<size_t>& out,
@@ -606,11 +933,11 @@ private:
               const std::vector<size_t>& gpr,
               const ov::intel_cpu::emitter_context *emit_context) const override {
         if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
-            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out, gpr);
         } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
-            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out, gpr);
         } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
-            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out, gpr);
         } else {
             IE_THROW() << host_isa_;
             assert(!"unsupported isa");
@@ -618,21 +945,29 @@ private:
     }
 
     template <dnnl::impl::cpu::x64::cpu_isa_t isa>
-    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out, const std::vector<size_t> &gpr) const {
         using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
                                             Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 in_reg(ea);
         Xmm vmm_src0 = Xmm(out[0]);
-        h->uni_vmovss(vmm_src0, h->ptr[in_reg]);
+        if (load_emitter) {
+            load_emitter->emit_code({ea}, {out[0]},
+                                    std::make_shared<load_emitter_context>(prc, InferenceEngine::Precision::FP32, 1),
+                                    {}, gpr);
+        } else {
+            h->uni_vmovss(vmm_src0, h->ptr[in_reg]);
+        }
 
         // Doesn't work if the same pointer comes with multiple load operations
         if (shouldPostIncrement) {
-            h->add(in_reg, sizeof(float));
+            h->add(in_reg, prc.size());
         }
     }
 
 private:
     bool shouldPostIncrement;
+    InferenceEngine::Precision prc;
+    std::shared_ptr<jit_load_emitter> load_emitter;
 };
 
 }   // namespace intel_cpu
@@ -24,6 +24,7 @@
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
@@ -32,6 +33,7 @@
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <fstream>
 
 using namespace ov::intel_cpu;
 using namespace InferenceEngine;
@@ -134,6 +136,16 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         MKLDNNExecNetwork::GetGraph();
     }
 
+    // the requests are served by any stream, so their tensors are spread over the NUMA nodes of the streams
+    std::vector<int> numaNodes;
+    for (auto& graph : _graphs) {
+        const int numaNode = graph.getNumaNode();
+        if (numaNode >= 0 && std::find(numaNodes.begin(), numaNodes.end(), numaNode) == numaNodes.end())
+            numaNodes.push_back(numaNode);
+    }
+    if (!numaNodes.empty())
+        _tensorsAllocator = std::make_shared<NumaInterleavedAllocator>(numaNodes);
+
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
@@ -161,10 +173,16 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
+    // the memory isn't bound without the streams, since the graph is used by the calling threads,
+    // and on the single node hosts, where all the memory is local anyway
+    int memoryNumaNodeId = -1;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
+        static const bool multipleNumaNodes = InferenceEngine::getAvailableNUMANodes().size() > 1;
+        if (multipleNumaNodes)
+            memoryNumaNodeId = numaNodeId;
     }
     auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
     if (!graphLock._graph.IsReady()) {
@@ -175,6 +193,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setNumaNode(memoryNumaNodeId);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -205,6 +224,36 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
     }
 }
 
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, Parameter> &config) {
+    const auto& traceKey = PluginConfigInternalParams::KEY_CPU_TRACE_FILE;
+    auto traceFile = config.find(traceKey);
+    if (traceFile == config.end() || config.size() > 1)
+        IE_THROW() << "The only config that can be set to the CPU ExecutableNetwork is the " << traceKey
+                   << " to export the execution timeline";
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        if (!_cfg.collectTrace)
+            IE_THROW() << "The execution timeline is not recorded, the " << PluginConfigInternalParams::KEY_CPU_TRACE
+                       << " must be passed to LoadNetwork to enable it";
+    }
+
+    const auto path = traceFile->second.as<std::string>();
+    std::ofstream out(path);
+    if (!out.is_open())
+        IE_THROW() << "Can't open the file " << path << " to export the execution timeline";
+
+    ExecutionTracer::writeTraceBegin(out);
+    bool first = true;
+    for (size_t i = 0; i < _graphs.size(); i++) {
+        // the lock only guards the graph creation, the requests keep running and recording the events,
+        // so the tracer skips the events which are being written
+        auto graphLock = Graph::Lock(_graphs[i]);
+        if (graphLock._graph.IsReady() && graphLock._graph.getTracer())
+            graphLock._graph.getTracer()->write(out, static_cast<int>(i), first);
+    }
+    ExecutionTracer::writeTraceEnd(out);
+}
+
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
 }
@@ -259,6 +308,11 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetricLegacy(const std::string
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        if (graph.hasDynamicInput())
+            metrics.push_back(METRIC_KEY(SHAPE_BUCKETS_PEAK_MEMORY));
+        if (graph.getProperty().collectPerfHistograms)
+            metrics.push_back(METRIC_KEY(NODE_LATENCY_PERCENTILES));
+        metrics.push_back(METRIC_KEY(NUMA_MEMORY_PLACEMENT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -273,6 +327,65 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetricLegacy(const std::string
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(SHAPE_BUCKETS_PEAK_MEMORY)) {
+        // each stream has its own graph, so the peak per bucket is the maximum over the streams
+        std::map<std::string, uint64_t> peaks;
+        auto collect = [&peaks](const MKLDNNGraph& g) {
+            for (const auto& peak : g.getDynamicMemoryPeaks())
+                peaks[peak.first] = std::max(peaks[peak.first], peak.second);
+        };
+        for (auto& g : _graphs) {
+            if (&g == &graph) {
+                collect(graph);
+            } else {
+                auto graphLock = Graph::Lock(g);
+                if (graphLock._graph.IsReady())
+                    collect(graphLock._graph);
+            }
+        }
+        IE_SET_METRIC_RETURN(SHAPE_BUCKETS_PEAK_MEMORY, peaks);
+    } else if (name == METRIC_KEY(NODE_LATENCY_PERCENTILES)) {
+        if (!graph.getProperty().collectPerfHistograms)
+            IE_THROW() << "Metric " << name << " requires the "
+                       << PluginConfigInternalParams::KEY_CPU_PERF_COUNT_HISTOGRAMS << " config key to be enabled";
+        // the buckets are the same for all the streams, so the histograms are merged before the percentiles estimation
+        std::map<std::string, LatencyHistogram::Counts> histograms;
+        for (auto& g : _graphs) {
+            if (&g == &graph) {
+                graph.AccumulateLatencyHistograms(histograms);
+            } else {
+                auto graphLock = Graph::Lock(g);
+                if (graphLock._graph.IsReady())
+                    graphLock._graph.AccumulateLatencyHistograms(histograms);
+            }
+        }
+        std::map<std::string, std::vector<double>> percentiles;
+        for (const auto& histogram : histograms) {
+            auto& nodePercentiles = percentiles[histogram.first];
+            for (auto p : {0.5, 0.9, 0.99, 1.0})
+                nodePercentiles.push_back(LatencyHistogram::percentile(histogram.second, p) / 1000.0);
+        }
+        IE_SET_METRIC_RETURN(NODE_LATENCY_PERCENTILES, percentiles);
+    } else if (name == METRIC_KEY(NUMA_MEMORY_PLACEMENT)) {
+        std::map<std::string, std::vector<uint64_t>> placements;
+        auto collect = [&placements](const MKLDNNGraph& g, size_t streamId) {
+            if (g.getNumaNode() < 0)
+                return;
+            const auto placement = g.getNumaPlacement();
+            placements[std::to_string(streamId)] = {static_cast<uint64_t>(g.getNumaNode()),
+                                                    placement.localBytes, placement.remoteBytes};
+        };
+        for (size_t streamId = 0; streamId < _graphs.size(); streamId++) {
+            auto& g = _graphs[streamId];
+            if (&g == &graph) {
+                collect(graph, streamId);
+            } else {
+                auto graphLock = Graph::Lock(g);
+                if (graphLock._graph.IsReady())
+                    collect(graphLock._graph, streamId);
+            }
+        }
+        IE_SET_METRIC_RETURN(NUMA_MEMORY_PLACEMENT, placements);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
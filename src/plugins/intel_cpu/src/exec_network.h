@@ -40,6 +40,8 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -68,6 +70,8 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // allocates the infer requests tensors, null if the NUMA placement is unknown
+    std::shared_ptr<InferenceEngine::IAllocator> _tensorsAllocator;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
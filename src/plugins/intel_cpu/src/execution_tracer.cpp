@@ -0,0 +1,120 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "execution_tracer.h"
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <thread>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// common time origin of all the streams, so the timelines are aligned in the trace
+ExecutionTracer::Clock::time_point traceEpoch() {
+    static const auto epoch = ExecutionTracer::Clock::now();
+    return epoch;
+}
+
+uint64_t currentThreadId() {
+    // Chrome trace expects an integer thread id, 31 bits are enough to keep the threads distinct
+    return std::hash<std::thread::id>()(std::this_thread::get_id()) & 0x7fffffff;
+}
+
+void writeEscaped(std::ostream& os, const std::string& str) {
+    for (auto c : str) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+               << std::dec << std::setfill(' ');
+        } else {
+            os << c;
+        }
+    }
+}
+
+double toMicroseconds(ExecutionTracer::Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+}   // namespace
+
+const std::string ExecutionTracer::inferEventName = "Infer";
+
+ExecutionTracer::ExecutionTracer(size_t capacity) : slots(std::max<size_t>(capacity, 1)) {
+    traceEpoch();
+}
+
+void ExecutionTracer::record(const std::string& name, const std::string* type, const void* request,
+                             Clock::time_point begin, Clock::time_point end) {
+    const uint64_t reservation = recorded.fetch_add(1, std::memory_order_relaxed);
+    auto& slot = slots[reservation % slots.size()];
+    // the event is dropped if the slot is still written by the one reserved a lap earlier
+    uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+    if ((seq & 1) || !slot.seq.compare_exchange_strong(seq, 2 * reservation + 1, std::memory_order_relaxed))
+        return;
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.event = {&name, type, request, currentThreadId(), begin, end};
+    slot.seq.store(2 * reservation + 2, std::memory_order_release);
+}
+
+void ExecutionTracer::write(std::ostream& os, int streamId, bool& first) const {
+    auto separate = [&] {
+        if (!first)
+            os << ",\n";
+        first = false;
+    };
+
+    separate();
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << streamId
+       << ",\"args\":{\"name\":\"Stream " << streamId << "\"}}";
+
+    const uint64_t total = recorded.load(std::memory_order_relaxed);
+    const uint64_t count = std::min<uint64_t>(total, slots.size());
+    const auto epoch = traceEpoch();
+    const auto flags = os.flags();
+    os << std::fixed << std::setprecision(3);
+    for (uint64_t i = total - count; i < total; i++) {
+        // the event is copied only if it's committed and isn't overwritten while copied
+        const auto& slot = slots[i % slots.size()];
+        const uint64_t committed = 2 * i + 2;
+        if (slot.seq.load(std::memory_order_acquire) != committed)
+            continue;
+        const Event event = slot.event;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) != committed)
+            continue;
+
+        separate();
+        os << "{\"name\":\"";
+        writeEscaped(os, *event.name);
+        os << "\",\"cat\":\"" << (event.type ? "node" : "request") << "\",\"ph\":\"X\""
+           << ",\"ts\":" << toMicroseconds(event.begin - epoch)
+           << ",\"dur\":" << toMicroseconds(event.end - event.begin)
+           << ",\"pid\":" << streamId << ",\"tid\":" << event.thread
+           << ",\"args\":{\"request\":\"" << event.request << "\"";
+        if (event.type) {
+            os << ",\"type\":\"";
+            writeEscaped(os, *event.type);
+            os << "\"";
+        }
+        os << "}}";
+    }
+    os.flags(flags);
+}
+
+void ExecutionTracer::writeTraceBegin(std::ostream& os) {
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+}
+
+void ExecutionTracer::writeTraceEnd(std::ostream& os) {
+    os << "\n]}\n";
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
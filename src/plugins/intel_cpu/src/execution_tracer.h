@@ -0,0 +1,92 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Timeline recorder of the graph execution of a single stream. Keeps the begin/end timestamps of the infer
+ * requests and the executed nodes in the ring buffer, so only the latest events are available and the memory
+ * doesn't grow with the execution time. The slots are reserved atomically, so the nodes of the parallel branches
+ * are recorded concurrently without locks. Every slot has the sequence number which is odd while the event is written
+ * and identifies the reservation once the event is committed, so the export skips the incomplete events.
+ *
+ * The events are exported in the Chrome trace format (chrome://tracing, Perfetto): every stream is a process
+ * and every thread executing the stream is a thread of that process.
+ */
+class ExecutionTracer {
+public:
+    using Ptr = std::shared_ptr<ExecutionTracer>;
+    using Clock = std::chrono::steady_clock;
+
+    explicit ExecutionTracer(size_t capacity);
+
+    // Records the lifetime of the scope as the node execution (type is not null) or the request inference
+    class Scope {
+    public:
+        Scope(ExecutionTracer* tracer, const std::string& name, const std::string* type, const void* request)
+            : tracer(tracer), name(name), type(type), request(request) {
+            if (tracer)
+                begin = Clock::now();
+        }
+
+        ~Scope() {
+            if (tracer)
+                tracer->record(name, type, request, begin, Clock::now());
+        }
+
+    private:
+        ExecutionTracer* tracer;
+        const std::string& name;
+        const std::string* type;
+        const void* request;
+        Clock::time_point begin;
+    };
+
+    /**
+     * Writes the recorded events as the comma separated Chrome trace events. May be called concurrently
+     * with the inference of the stream, the events which are not committed yet are skipped.
+     */
+    void write(std::ostream& os, int streamId, bool& first) const;
+
+    static void writeTraceBegin(std::ostream& os);
+    static void writeTraceEnd(std::ostream& os);
+
+    static const std::string inferEventName;
+
+private:
+    struct Event {
+        // the strings are owned by the graph nodes
+        const std::string* name;
+        const std::string* type;
+        const void* request;
+        uint64_t thread;
+        Clock::time_point begin;
+        Clock::time_point end;
+    };
+
+    struct Slot {
+        // 2 * reservation + 1 while the event is written, 2 * reservation + 2 when it's committed
+        std::atomic<uint64_t> seq{0};
+        Event event;
+    };
+
+    void record(const std::string& name, const std::string* type, const void* request,
+                Clock::time_point begin, Clock::time_point end);
+
+    std::vector<Slot> slots;
+    std::atomic<uint64_t> recorded{0};
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -13,6 +13,9 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <set>
+#include <atomic>
+#include <functional>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -27,6 +30,7 @@
 #include "nodes/convert.h"
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -50,6 +54,10 @@
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#include <tbb/task_group.h>
+#endif
+
 using namespace mkldnn;
 using namespace ov::intel_cpu;
 using namespace InferenceEngine;
@@ -58,17 +66,23 @@ using namespace InferenceEngine::details;
 typedef std::unordered_set<MKLDNNEdgePtr> edge_cluster_t;
 typedef std::vector<edge_cluster_t> edge_clusters_t;
 
+// the number of the latest events kept by the execution timeline per stream (~3 MB)
+static const size_t traceCapacity = 1 << 16;
+
 mkldnn::engine MKLDNNGraph::eng(mkldnn::engine::kind::cpu, 0);
 
 template<typename NET>
 void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMgr,
         MKLDNNWeightsSharing::Ptr &w_cache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::intel_cpu::itt::domains::intel_cpu_LT, "CreateGraph");
+    NumaNodeScope numaScope(numaNodeId);
 
     if (IsReady())
         ForgetGraphData();
-    // disable weights caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable weights caching if graph was created only once and the data are not shared with other processes
+    weightsCache = config.streamExecutorConfig._streams != 1 || !config.sharedWeightsDir.empty() ? w_cache : nullptr;
+    weightsStorage = weightsCache && !config.sharedWeightsDir.empty()
+                     ? std::make_shared<MKLDNNWeightsStorage>(config.sharedWeightsDir) : nullptr;
 
     rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
 
@@ -84,10 +98,14 @@ void MKLDNNGraph::CreateGraph(const std::vector<MKLDNNNodePtr> &graphNodes,
                               const std::vector<MKLDNNEdgePtr> &graphEdges,
                               MKLDNNWeightsSharing::Ptr &w_cache,
                               std::string name) {
+    NumaNodeScope numaScope(numaNodeId);
+
     if (IsReady())
         ForgetGraphData();
-    // disable weights caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable weights caching if graph was created only once and the data are not shared with other processes
+    weightsCache = config.streamExecutorConfig._streams != 1 || !config.sharedWeightsDir.empty() ? w_cache : nullptr;
+    weightsStorage = weightsCache && !config.sharedWeightsDir.empty()
+                     ? std::make_shared<MKLDNNWeightsStorage>(config.sharedWeightsDir) : nullptr;
 
     rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
 
@@ -401,6 +419,11 @@ void MKLDNNGraph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
+    InitParallelBranches();
+
+    if (config.collectTrace)
+        tracer = std::make_shared<ExecutionTracer>(traceCapacity);
+
     ExecuteConstantNodesOnly();
 }
 
@@ -456,10 +479,83 @@ void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
              * we execute a node, which is not ready to be executed
              */
             executableGraphNodes.emplace_back(graphNode);
+            if (config.collectPerfHistograms)
+                graphNode->PerfCounter().enableHistogram();
         }
     }
 }
 
+void MKLDNNGraph::InitParallelBranches() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "MKLDNNGraph::InitParallelBranches");
+    parallelBranchesReady = false;
+    execNodesPredecessorsNum.clear();
+    execNodesSuccessors.clear();
+    // the dependencies are needed only once here
+    std::vector<std::pair<MKLDNNNodePtr, MKLDNNNodePtr>> memoryDeps;
+    std::swap(memoryDeps, memoryReuseDeps);
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelBranches || executableGraphNodes.size() < 2)
+        return;
+
+    // Dynamic nodes reallocate their memory during execution and memory nodes are connected
+    // through the variable states rather than edges, so such graphs are always executed sequentially
+    for (const auto& node : graphNodes) {
+        if (node->isDynamicNode() || one_of(node->getType(), MemoryInput, MemoryOutput))
+            return;
+    }
+
+    std::unordered_map<MKLDNNNode*, size_t> execIndices;
+    for (size_t i = 0; i < executableGraphNodes.size(); i++)
+        execIndices[executableGraphNodes[i].get()] = i;
+
+    // Non executable nodes (Input, optimized out Reshape, etc.) are transparent for the dependencies,
+    // so for each node collect the closest executable nodes it depends on
+    std::unordered_map<MKLDNNNode*, std::set<size_t>> execProducers;
+    std::vector<std::set<size_t>> predecessors(executableGraphNodes.size());
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        std::set<size_t> producers;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            auto it = execProducers.find(parent.get());
+            if (it != execProducers.end())
+                producers.insert(it->second.begin(), it->second.end());
+        }
+
+        auto execIt = execIndices.find(node.get());
+        if (execIt != execIndices.end()) {
+            predecessors[execIt->second] = std::move(producers);
+            execProducers[node.get()] = {execIt->second};
+        } else {
+            execProducers[node.get()] = std::move(producers);
+        }
+    }
+
+    // Memory reuse dependencies always point forward in the sequential execution order, so the graph stays acyclic.
+    // Non executable readers (e.g. in-place Reshape) are skipped since their consumers belong to the same edge cluster.
+    for (const auto& dep : memoryDeps) {
+        auto readerIt = execIndices.find(dep.first.get());
+        auto writerIt = execIndices.find(dep.second.get());
+        if (readerIt == execIndices.end() || writerIt == execIndices.end() || readerIt->second == writerIt->second)
+            continue;
+        predecessors[writerIt->second].insert(readerIt->second);
+    }
+
+    execNodesPredecessorsNum.resize(executableGraphNodes.size());
+    execNodesSuccessors.resize(executableGraphNodes.size());
+    for (size_t i = 0; i < predecessors.size(); i++) {
+        execNodesPredecessorsNum[i] = predecessors[i].size();
+        for (auto pred : predecessors[i])
+            execNodesSuccessors[pred].push_back(i);
+    }
+
+    parallelBranchesReady = true;
+#endif
+}
+
 void MKLDNNGraph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
     mkldnn::stream stream(eng);
@@ -493,7 +589,13 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
             auto sharedOutputs = acquireSharedOutputs(node);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                ExecuteNode(node, stream);
+                MKLDNNWeightsStorage::Key storageKey;
+                if (std::get<1>(sharedOutputs) || !RestoreFromWeightsStorage(node, storageKey)) {
+                    ExecuteNode(node, stream);
+
+                    if (!storageKey.empty())
+                        weightsStorage->store(storageKey, node->getChildEdgeAt(0)->getMemory());
+                }
 
                 for (auto & output : std::get<2>(sharedOutputs))
                     output->valid(true);
@@ -504,6 +606,30 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
     }
 }
 
+bool MKLDNNGraph::RestoreFromWeightsStorage(const MKLDNNNodePtr& node, MKLDNNWeightsStorage::Key& key) const {
+    // Only the output of a reorder is fully defined by its input data and the memory descriptors,
+    // so it's the only constant node which data may be addressed by content
+    if (!weightsStorage || node->getType() != Reorder ||
+        node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+        return false;
+
+    const auto& srcMemory = node->getParentEdgeAt(0)->getMemory();
+    auto dstMemory = node->getChildEdgeAt(0)->getMemoryPtr();
+    if (!srcMemory.getDesc().isDefined() || !dstMemory->getDesc().isDefined())
+        return false;
+
+    key = MKLDNNWeightsStorage::makeKey(srcMemory, dstMemory->getDesc());
+    auto storedData = weightsStorage->find(key, dstMemory->GetSize());
+    if (!storedData)
+        return false;
+
+    // the stored data already contain zero pads, so the mapped pages stay clean and shared between processes
+    dstMemory->setDataHandle(storedData->data(), false);
+    weightsCache->retain(storedData);
+    key = {};
+    return true;
+}
+
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDescPtr& childDesc, const mkldnn::engine& eng) {
     auto definedParentDesc = parentDesc->isDefined() ? parentDesc : MemoryDescUtils::makeDummyDesc(*parentDesc);
     memory::desc srcMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(definedParentDesc)->getDnnlDesc();
@@ -731,6 +857,30 @@ void MKLDNNGraph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
+    memoryReuseDeps.clear();
+    if (config.parallelBranches) {
+        // The solver places boxes with disjoint live time into the same memory, which is valid only for the sequential
+        // execution order. Record such pairs so the parallel branches scheduler keeps the same order for them.
+        for (int i = 0; i < edge_clusters.size(); i++) {
+            if (boxes[i].finish == -1)
+                continue;
+            const int64_t i_begin = memSolver.getOffset(i);
+            for (int j = 0; j < edge_clusters.size(); j++) {
+                if (i == j || boxes[j].start <= boxes[i].finish)
+                    continue;
+                const int64_t j_begin = memSolver.getOffset(j);
+                if (i_begin >= j_begin + boxes[j].size || j_begin >= i_begin + boxes[i].size)
+                    continue;
+                // cluster i dies before cluster j is born and they overlap in memory
+                for (auto &reader : edge_clusters[i]) {
+                    for (auto &writer : edge_clusters[j]) {
+                        memoryReuseDeps.emplace_back(reader->getChild(), writer->getParent());
+                    }
+                }
+            }
+        }
+    }
+
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
 
@@ -772,6 +922,10 @@ void MKLDNNGraph::Allocate() {
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
 
+    // The edges with undefined size which are left are planned at runtime per input shapes bucket
+    if (graphHasDynamicInput)
+        dynamicMemoryPlanner.init(graphEdges);
+
     // Create dummy memory with undefined desc for edges that are need allocation but has not been allocated withing mem solver
     for (auto& edge : graphEdges) edge->allocate();
 
@@ -780,6 +934,8 @@ void MKLDNNGraph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    dynamicMemoryPlanner.bind();
 }
 
 void MKLDNNGraph::CreatePrimitives() {
@@ -951,22 +1107,96 @@ inline void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::st
     }
 }
 
+void MKLDNNGraph::InferParallelBranches(MKLDNNInferRequestBase* request) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    const size_t nodesNum = executableGraphNodes.size();
+    std::unique_ptr<std::atomic<size_t>[]> pendingPredecessors(new std::atomic<size_t>[nodesNum]);
+    for (size_t i = 0; i < nodesNum; i++)
+        pendingPredecessors[i] = execNodesPredecessorsNum[i];
+
+    // The tasks are spawned into the arena of the current stream, so the branches share the stream's threads
+    tbb::task_group taskGroup;
+    std::function<void(size_t)> executeChain = [&](size_t idx) {
+        NumaNodeScope numaScope(numaNodeId);
+        mkldnn::stream stream(eng);
+        while (idx < nodesNum) {
+            const auto& node = executableGraphNodes[idx];
+            {
+                VERBOSE(node, config.verbose);
+                PERF(node, config.collectPerfCounters);
+                ExecutionTracer::Scope traceScope(tracer.get(), node->getName(), &node->getTypeStr(), request);
+
+                if (request)
+                    request->ThrowIfCanceled();
+                ExecuteNode(node, stream);
+            }
+
+            // continue with the first ready successor on the same thread and spawn the rest
+            size_t next = nodesNum;
+            for (auto successor : execNodesSuccessors[idx]) {
+                if (--pendingPredecessors[successor] != 0)
+                    continue;
+                if (next == nodesNum) {
+                    next = successor;
+                } else {
+                    taskGroup.run([&executeChain, successor] { executeChain(successor); });
+                }
+            }
+            idx = next;
+        }
+    };
+
+    for (size_t i = 0; i < nodesNum; i++) {
+        if (execNodesPredecessorsNum[i] == 0)
+            taskGroup.run([&executeChain, i] { executeChain(i); });
+    }
+    taskGroup.wait();
+#else
+    IE_THROW() << "Parallel branches execution is not supported by the current threading backend";
+#endif
+}
+
 void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
+    ExecutionTracer::Scope traceScope(tracer.get(), ExecutionTracer::inferEventName, nullptr, request);
+    // the dynamic shapes may reallocate the edges memory during the inference
+    NumaNodeScope numaScope(numaNodeId);
+
+    if (parallelBranchesReady) {
+        InferParallelBranches(request);
+        if (infer_count != -1) infer_count++;
+        return;
+    }
+
     mkldnn::stream stream(eng);
 
+    const bool planDynamicMemory = !dynamicMemoryPlanner.empty();
+    if (planDynamicMemory) {
+        std::vector<VectorDims> inputDims;
+        for (const auto& input : inputNodesMap) {
+            const auto& node = input.second;
+            if (!node->getChildEdges().empty())
+                inputDims.push_back(node->getChildEdgeAt(0)->getMemory().getStaticDims());
+        }
+        dynamicMemoryPlanner.prepare(DynamicMemoryPlanner::makeBucketKey(inputDims));
+    }
+
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, config.verbose);
         PERF(node, config.collectPerfCounters);
+        ExecutionTracer::Scope traceScope(tracer.get(), node->getName(), &node->getTypeStr(), request);
 
         if (request)
             request->ThrowIfCanceled();
         ExecuteNode(node, stream);
     }
 
+    if (planDynamicMemory)
+        dynamicMemoryPlanner.finalize();
+
     if (infer_count != -1) infer_count++;
 }
 
@@ -1056,6 +1286,26 @@ void MKLDNNGraph::SortTopologically() {
     }
 }
 
+void MKLDNNGraph::AccumulateLatencyHistograms(std::map<std::string, LatencyHistogram::Counts>& histograms) const {
+    for (const auto& node : executableGraphNodes) {
+        if (const auto histogram = node->PerfCounter().getHistogram())
+            histogram->accumulate(histograms[node->getName()]);
+    }
+}
+
+NumaPlacement MKLDNNGraph::getNumaPlacement() const {
+    std::vector<std::pair<const void*, size_t>> regions;
+    for (const auto& edge : graphEdges) {
+        if (edge->getStatus() != MKLDNNEdge::Status::Allocated)
+            continue;
+        const auto& memory = edge->getMemory();
+        const auto size = memory.getDesc().getCurrentMemSize();
+        if (memory.isAllocated() && size != MemoryDesc::UNDEFINED_SIZE)
+            regions.emplace_back(memory.GetData(), size);
+    }
+    return ov::intel_cpu::getNumaPlacement(regions, numaNodeId);
+}
+
 void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     unsigned i = 0;
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
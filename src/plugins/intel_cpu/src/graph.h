@@ -11,6 +11,9 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "dynamic_memory_planner.h"
+#include "execution_tracer.h"
+#include "utils/numa_memory.hpp"
 #include <map>
 #include <string>
 #include <vector>
@@ -25,6 +28,7 @@ class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
     MKLDNNWeightsSharing::Ptr weightsCache;
+    MKLDNNWeightsStorage::Ptr weightsStorage;
 
     enum Status {
         NotReady = 0,
@@ -47,6 +51,15 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    // the memory allocated by the graph is bound to the NUMA node, the negative id leaves the placement to the system
+    void setNumaNode(int numaNode) {
+        numaNodeId = numaNode;
+    }
+
+    int getNumaNode() const {
+        return numaNodeId;
+    }
+
     template<typename NET>
     void CreateGraph(NET &network,
                      const MKLDNNExtensionManager::Ptr& extMgr,
@@ -191,6 +204,22 @@ public:
         return graphHasDynamicInput;
     }
 
+    // null unless the execution timeline recording is enabled
+    const ExecutionTracer* getTracer() const {
+        return tracer.get();
+    }
+
+    // adds the latency histograms of the executed nodes to the ones collected from the other streams
+    void AccumulateLatencyHistograms(std::map<std::string, LatencyHistogram::Counts>& histograms) const;
+
+    // placement of the resident edges memory relative to the NUMA node of the graph
+    NumaPlacement getNumaPlacement() const;
+
+    // packed memory size of the dynamic edges per input shape bucket
+    std::map<std::string, uint64_t> getDynamicMemoryPeaks() const {
+        return dynamicMemoryPlanner.getPeakMemory();
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -203,6 +232,8 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        dynamicMemoryPlanner.reset();
+        tracer.reset();
     }
     Status status { NotReady };
     Config config;
@@ -213,7 +244,10 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    int numaNodeId = -1;
+
     MKLDNNMemoryPtr memWorkspace;
+    DynamicMemoryPlanner dynamicMemoryPlanner;
 
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
@@ -237,8 +271,11 @@ protected:
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
+    void InitParallelBranches();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    bool RestoreFromWeightsStorage(const MKLDNNNodePtr& node, MKLDNNWeightsStorage::Key& key) const;
+    void InferParallelBranches(MKLDNNInferRequestBase* request);
 
     friend class MKLDNNInferRequestBase;
     friend class MKLDNNLegacyInferRequest;
@@ -256,8 +293,19 @@ private:
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
 
+    // dependency DAG over executableGraphNodes used by the parallel branches execution mode:
+    // for each executable node the number of its predecessors and indices of its successors
+    bool parallelBranchesReady = false;
+    std::vector<size_t> execNodesPredecessorsNum;
+    std::vector<std::vector<size_t>> execNodesSuccessors;
+    // (reader, writer) pairs of nodes which use the same memory region of the workspace
+    // at different moments of time, so the writer must not start until the reader is finished
+    std::vector<std::pair<MKLDNNNodePtr, MKLDNNNodePtr>> memoryReuseDeps;
+
     MultiCachePtr rtParamsCache;
 
+    ExecutionTracer::Ptr tracer;
+
     void EnforceBF16();
 };
 
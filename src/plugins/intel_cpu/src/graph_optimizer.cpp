@@ -11,6 +11,8 @@
 #include "nodes/concat.h"
 #include "nodes/reorder.h"
 #include "nodes/conv.h"
+#include "nodes/fullyconnected.h"
+#include "nodes/embedding_bag_sum.h"
 #include "nodes/deconv.h"
 #include "nodes/bin_conv.h"
 #include "nodes/fake_quantize.h"
@@ -58,7 +60,16 @@ using namespace InferenceEngine;
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
 void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations",
+                       "FuseFullyConnectedAndWeightsDecompression");
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndTableDecompression");
+    FuseEmbeddingBagAndTableDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -639,6 +650,215 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
     }
 }
 
+static bool isDecompressionConstant(const MKLDNNNodePtr& node, const std::vector<Precision>& precisions) {
+    return node->getType() == Input && node->isConstant() &&
+           std::find(precisions.begin(), precisions.end(), node->getOriginalOutputPrecisionAtPort(0)) != precisions.end();
+}
+
+static bool isDecompressionEltwise(const MKLDNNNodePtr& node, Algorithm algorithm) {
+    return node->getType() == Eltwise && node->getAlgorithm() == algorithm && node->getFusedWith().empty() &&
+           node->getParentEdges().size() == 2 && node->getChildEdges().size() == 1 &&
+           node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+           isDecompressionConstant(node->getParentEdgesAtPort(1)[0]->getParent(), {Precision::FP32});
+}
+
+// The decompression subgraph of the compressed constant: Multiply <- [Subtract] <- Convert <- u8/i8 Constant
+struct DecompressionSubgraph {
+    MKLDNNNodePtr multiply;
+    MKLDNNNodePtr subtract;
+    MKLDNNNodePtr convert;
+    MKLDNNNodePtr weights;
+};
+
+static bool matchDecompressionSubgraph(const MKLDNNNodePtr& multiply, DecompressionSubgraph& subgraph) {
+    if (!isDecompressionEltwise(multiply, EltwiseMultiply))
+        return false;
+    auto parent = multiply->getParentEdgesAtPort(0)[0]->getParent();
+
+    MKLDNNNodePtr subtract;
+    if (parent->getType() == Eltwise) {
+        if (!isDecompressionEltwise(parent, EltwiseSubtract))
+            return false;
+        subtract = parent;
+        parent = subtract->getParentEdgesAtPort(0)[0]->getParent();
+    }
+
+    auto convert = parent;
+    if (convert->getType() != Convert || convert->getChildEdges().size() != 1 ||
+        convert->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+        return false;
+    auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+    if (!isDecompressionConstant(weights, {Precision::U8, Precision::I8}))
+        return false;
+
+    subgraph = {multiply, subtract, convert, weights};
+    return true;
+}
+
+// Gathers the values of the constant broadcast to the weights dims per [group][output channel].
+// The constant must be the same for the whole group, i.e. its innermost dim is 1.
+static bool getDecompressionValues(const MKLDNNNodePtr& constNode, const VectorDims& weightsDims, std::vector<float>& values) {
+    auto dims = constNode->getOutputShapeAtPort(0).getStaticDims();
+    if (dims.size() > weightsDims.size())
+        return false;
+    dims.insert(dims.begin(), weightsDims.size() - dims.size(), 1);
+    if (dims.back() != 1)
+        return false;
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (dims[i] != 1 && dims[i] != weightsDims[i])
+            return false;
+    }
+
+    auto* constInput = dynamic_cast<MKLDNNInputNode*>(constNode.get());
+    if (constInput == nullptr)
+        IE_THROW() << "Cannot cast to Input node";
+    const auto* data = static_cast<const float*>(constInput->getMemoryPtr()->GetPtr());
+    if (data == nullptr)
+        IE_THROW() << "Decompression constant has not allocated buffer";
+
+    const size_t N = weightsDims[0];
+    const size_t G = weightsDims.size() == 3 ? weightsDims[1] : 1;
+    const size_t groupDim = weightsDims.size() == 3 ? dims[1] : 1;
+    values.resize(G * N);
+    for (size_t g = 0; g < G; g++) {
+        for (size_t n = 0; n < N; n++) {
+            values[g * N + n] = data[(dims[0] == 1 ? 0 : n) * groupDim + (groupDim == 1 ? 0 : g)];
+        }
+    }
+    return true;
+}
+
+// Returns the scales and the zero points multiplied by the scales of the decompression subgraph.
+static bool getDecompressionParams(const DecompressionSubgraph& subgraph, const VectorDims& weightsDims,
+                                   std::vector<float>& scales, std::vector<float>& zeroPointsScaled) {
+    if (!getDecompressionValues(subgraph.multiply->getParentEdgesAtPort(1)[0]->getParent(), weightsDims, scales))
+        return false;
+    std::vector<float> zeroPoints(scales.size(), 0.f);
+    if (subgraph.subtract && !getDecompressionValues(subgraph.subtract->getParentEdgesAtPort(1)[0]->getParent(), weightsDims, zeroPoints))
+        return false;
+
+    zeroPointsScaled.resize(scales.size());
+    for (size_t j = 0; j < scales.size(); j++)
+        zeroPointsScaled[j] = zeroPoints[j] * scales[j];
+    return true;
+}
+
+static void dropDecompressionSubgraph(MKLDNNGraph &graph, const DecompressionSubgraph& subgraph) {
+    auto scalesEdge = subgraph.multiply->getParentEdgesAtPort(1)[0];
+    graph.RemoveEdge(scalesEdge);
+    graph.DropNode(subgraph.multiply);
+    if (subgraph.subtract) {
+        auto zeroPointsEdge = subgraph.subtract->getParentEdgesAtPort(1)[0];
+        graph.RemoveEdge(zeroPointsEdge);
+        graph.DropNode(subgraph.subtract);
+    }
+    graph.DropNode(subgraph.convert);
+}
+
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto fc = graphNodes[i];
+        if (fc->getType() != FullyConnected)
+            continue;
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(fc.get());
+        if (fcNode == nullptr)
+            IE_THROW() << "Cannot get FullyConnected node " << fc->getName();
+
+        // the BF16 and INT8 FullyConnected keep the folded weights
+        if (fc->getOriginalInputPrecisionAtPort(0) != Precision::FP32 || fc->getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+            fc->getOriginalInputPrecisionAtPort(1) != Precision::FP32)
+            continue;
+        if (!one_of(fc->getInputShapeAtPort(0).getRank(), 2, 3) || fc->getInputShapeAtPort(1).getRank() != 2)
+            continue;
+
+        const auto& fcWeightsDims = fc->getInputShapeAtPort(1).getStaticDims();
+        const size_t N = fcWeightsDims[0];
+        const size_t K = fcWeightsDims[1];
+
+        // FC <- [Reshape] <- Multiply <- [Subtract] <- Convert <- u8/i8 Constant
+        auto parent = fc->getParentEdgesAtPort(1)[0]->getParent();
+        MKLDNNNodePtr reshape;
+        if (parent->getType() == Reshape) {
+            if (parent->getChildEdges().size() != 1)
+                continue;
+            reshape = parent;
+            parent = reshape->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        DecompressionSubgraph subgraph;
+        if (!matchDecompressionSubgraph(parent, subgraph))
+            continue;
+
+        // the weights are [N, K] or [N, G, K / G] reshaped to [N, K] for the group-wise decompression
+        const auto& weightsDims = subgraph.weights->getOutputShapeAtPort(0).getStaticDims();
+        if (weightsDims.size() == 2) {
+            if (weightsDims != fcWeightsDims)
+                continue;
+        } else if (weightsDims.size() == 3) {
+            if (!reshape || weightsDims[0] != N || weightsDims[1] * weightsDims[2] != K)
+                continue;
+        } else {
+            continue;
+        }
+
+        std::vector<float> scales, zeroPointsScaled;
+        if (!getDecompressionParams(subgraph, weightsDims, scales, zeroPointsScaled))
+            continue;
+
+        fcNode->decompressionScales = std::move(scales);
+        fcNode->decompressionZeroPointsScaled = std::move(zeroPointsScaled);
+        fcNode->decompressionGroups = weightsDims.size() == 3 ? weightsDims[1] : 1;
+
+        const auto weightsPrecision = subgraph.weights->getOriginalOutputPrecisionAtPort(0);
+        fc->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+        // the reshape stays to keep the [N, K] weights dims on the FullyConnected port, but it's a view of the compressed constant now
+        if (reshape) {
+            reshape->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshape->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
+
+        dropDecompressionSubgraph(graph, subgraph);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseEmbeddingBagAndTableDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto embBag = graphNodes[i];
+        if (!one_of(embBag->getType(), EmbeddingBagOffsetsSum, EmbeddingBagPackedSum, EmbeddingSegmentsSum))
+            continue;
+        auto* embBagNode = dynamic_cast<MKLDNNEmbeddingBagSumNode*>(embBag.get());
+        if (embBagNode == nullptr)
+            IE_THROW() << "Cannot get EmbeddingBag node " << embBag->getName();
+
+        if (embBag->getOriginalInputPrecisionAtPort(0) != Precision::FP32 || embBag->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+
+        // EmbeddingBag <- Multiply <- [Subtract] <- Convert <- u8/i8 Constant
+        DecompressionSubgraph subgraph;
+        if (!matchDecompressionSubgraph(embBag->getParentEdgesAtPort(0)[0]->getParent(), subgraph))
+            continue;
+
+        // the decompression is row-wise: the [V, D] table has the scale and the zero point per row
+        const auto& tableDims = subgraph.weights->getOutputShapeAtPort(0).getStaticDims();
+        if (tableDims.size() != 2)
+            continue;
+
+        std::vector<float> scales, zeroPointsScaled;
+        if (!getDecompressionParams(subgraph, tableDims, scales, zeroPointsScaled))
+            continue;
+
+        embBagNode->decompressionScales = std::move(scales);
+        embBagNode->decompressionZeroPointsScaled = std::move(zeroPointsScaled);
+        embBag->setOriginalInputPrecisionAtPort(0, subgraph.weights->getOriginalOutputPrecisionAtPort(0));
+
+        dropDecompressionSubgraph(graph, subgraph);
+    }
+}
+
 /**
  * @todo FQ fusing was disabled for BF16 output since oneDNN primitives lack support
  *       for bf16 depthwise postops.
@@ -37,6 +37,8 @@ private:
 
     void DropDoubleReorders(MKLDNNGraph& graph);
     void FuseConvolutionAndZeroPoints(MKLDNNGraph &graph);
+    void FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph);
+    void FuseEmbeddingBagAndTableDecompression(MKLDNNGraph &graph);
     void FuseBroadcastAndEltwise(MKLDNNGraph &graph);
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
     void FusePerformedAsScaleShiftAndFakeQuantize(MKLDNNGraph &graph);
@@ -92,41 +92,17 @@ void ov::intel_cpu::MKLDNNInferRequestBase::pushInput(const std::string& inputNa
 void ov::intel_cpu::MKLDNNInferRequestBase::PushStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            auto cur_node = std::dynamic_pointer_cast<MKLDNNMemoryInputNode>(node);
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
             }
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
-        }
-    }
-}
-
-void ov::intel_cpu::MKLDNNInferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    IE_ASSERT(cur_state != nullptr);
+                    // no copy if the graph still keeps the state of this request from the previous inference
+                    cur_state->PushTo(cur_node);
                 }
             }
         }
@@ -173,17 +149,21 @@ void ov::intel_cpu::MKLDNNInferRequestBase::InferImpl() {
         PushStates();
     }
 
+    // the states values stay in the graph memory and are copied to the states blobs on query only
     graph->Infer(this);
 
-    if (memoryStates.size() != 0) {
-        PullStates();
-    }
-
     ThrowIfCanceled();
 
     graph->PullOutputData(_outputs);
 }
 
+InferenceEngine::Blob::Ptr ov::intel_cpu::MKLDNNInferRequestBase::createTensor(const InferenceEngine::TensorDesc& desc) const {
+    auto blob = execNetwork->_tensorsAllocator ? make_blob_with_precision(desc, execNetwork->_tensorsAllocator)
+                                               : make_blob_with_precision(desc);
+    blob->allocate();
+    return blob;
+}
+
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> ov::intel_cpu::MKLDNNInferRequestBase::GetPerformanceCounts() const {
     if (!graph || !graph->IsReady())
         IE_THROW() << "Graph is not ready!";
@@ -513,8 +493,7 @@ InferenceEngine::Blob::Ptr ov::intel_cpu::MKLDNNLegacyInferRequest::GetBlob(cons
                 desc = InferenceEngine::TensorDesc(p, dims, l);
             }
 
-            _inputs[name] = make_blob_with_precision(desc);
-            _inputs[name]->allocate();
+            _inputs[name] = createTensor(desc);
             if (pBlob->getTensorDesc() == desc &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = _inputs[name]->buffer();
@@ -559,8 +538,7 @@ InferenceEngine::Blob::Ptr ov::intel_cpu::MKLDNNLegacyInferRequest::GetBlob(cons
                 auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
                 desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-                data = make_blob_with_precision(desc);
-                data->allocate();
+                data = createTensor(desc);
             } else {
                 const auto& expectedTensorDesc = pBlob->getTensorDesc();
 
@@ -781,8 +759,7 @@ InferenceEngine::Blob::Ptr ov::intel_cpu::MKLDNNInferRequest::GetBlob(const std:
                 InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(inputNode->second->get_output_element_type(0)),
                                                  dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                _inputs[name] = make_blob_with_precision(desc);
-                _inputs[name]->allocate();
+                _inputs[name] = createTensor(desc);
 
                 if (!isDynamic &&
                     desc == MemoryDescUtils::convertToTensorDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc()) &&
@@ -816,8 +793,7 @@ InferenceEngine::Blob::Ptr ov::intel_cpu::MKLDNNInferRequest::GetBlob(const std:
                     InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(outputNode->second->get_input_element_type(0)),
                                                      dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                    data = make_blob_with_precision(desc);
-                    data->allocate();
+                    data = createTensor(desc);
                 } else {
                     if (!shape.compatible(ov::PartialShape(data->getTensorDesc().getDims()))) {
                         IE_THROW(ParameterMismatch) << "Network input and output use the same name: " << name << ", but expect blobs with different shapes.";
@@ -51,6 +51,8 @@ protected:
     void CreateInferRequest();
     InferenceEngine::Precision normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const;
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    // allocates the blob owned by the request according to the NUMA placement of the streams
+    InferenceEngine::Blob::Ptr createTensor(const InferenceEngine::TensorDesc& desc) const;
 
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
@@ -60,7 +62,6 @@ protected:
 
 private:
     void PushStates();
-    void PullStates();
     void redefineMemoryForInputNodes();
 
     void changeDefaultPtr();
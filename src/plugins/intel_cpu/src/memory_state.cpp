@@ -5,6 +5,7 @@
 #include "memory_state.h"
 #include "extension_utils.h"
 #include "blob_factory.hpp"
+#include "nodes/memory.hpp"
 
 using namespace InferenceEngine;
 
@@ -12,9 +13,68 @@ namespace ov {
 namespace intel_cpu {
 
 void  MKLDNNVariableState::Reset() {
+    std::lock_guard<std::mutex> lock{mutex};
+    detach(false);
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    std::lock_guard<std::mutex> lock{mutex};
+    detach(false);
+    IVariableStateInternal::SetState(newState);
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (auto node = residentNode.lock()) {
+        std::lock_guard<std::mutex> nodeLock{node->getStateMutex()};
+        if (node->getStateOwner().get() == this) {
+            copyFrom(*node);
+        }
+    }
+    return state;
+}
+
+void MKLDNNVariableState::PushTo(const std::shared_ptr<MKLDNNMemoryInputNode>& node) {
+    std::lock_guard<std::mutex> lock{mutex};
+    auto prevNode = residentNode.lock();
+    if (prevNode != node) {
+        // the request is executed on the other graph, so moving the value from the previous one
+        detach(true);
+    }
+
+    std::lock_guard<std::mutex> nodeLock{node->getStateMutex()};
+    auto owner = node->getStateOwner();
+    if (owner.get() == this) {
+        return;
+    }
+    if (owner) {
+        // the state of the other request is not lost, the node is locked so it is safe to update its blob
+        owner->copyFrom(*node);
+    }
+    node->setStateOwner(std::static_pointer_cast<MKLDNNVariableState>(shared_from_this()));
+    residentNode = node;
+
+    auto storage = node->getStore();
+    cpu_memcpy(storage->GetData(), state->cbuffer().as<const void*>(), state->byteSize());
+}
+
+void MKLDNNVariableState::detach(bool saveValue) {
+    if (auto node = residentNode.lock()) {
+        std::lock_guard<std::mutex> nodeLock{node->getStateMutex()};
+        if (node->getStateOwner().get() == this) {
+            if (saveValue)
+                copyFrom(*node);
+            node->setStateOwner(nullptr);
+        }
+    }
+    residentNode.reset();
+}
+
+void MKLDNNVariableState::copyFrom(MKLDNNMemoryInputNode& node) const {
+    auto storage = node.getStore();
+    cpu_memcpy(state->buffer(), storage->GetData(), state->byteSize());
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -10,11 +10,19 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <memory>
+#include <mutex>
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+class MKLDNNMemoryInputNode;
+
+/**
+ * The value of the state bound to the graph (see PushTo) stays in the graph memory between the inferences
+ * and is copied to the state blob only when it is queried by the user.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
     MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
@@ -25,6 +33,24 @@ public:
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    /**
+     * @brief Makes the state value the input of the ReadValue node for the next inference.
+     * The copy is skipped if the node memory already holds the latest value of this state,
+     * otherwise the value of the state previously bound to the node is saved to its blob first.
+     */
+    void PushTo(const std::shared_ptr<MKLDNNMemoryInputNode>& node);
+
+private:
+    // unbinds the state from the node, the latest value is copied to the state blob if saveValue is set
+    void detach(bool saveValue);
+    void copyFrom(MKLDNNMemoryInputNode& node) const;
+
+    mutable std::mutex mutex;
+    // the node which memory holds the latest value of the state
+    std::weak_ptr<MKLDNNMemoryInputNode> residentNode;
 };
 
 }   // namespace intel_cpu
@@ -3,17 +3,36 @@
 //
 
 #include "convert_matmul_to_fc.hpp"
+#include "mark_weights_decompression.hpp"
 #include "op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 
 NGRAPH_RTTI_DEFINITION(ov::intel_cpu::ConvertMatMulToFC, "ConvertMatMulToFC", 0);
 
+namespace {
+
+// Returns the Convert of the compressed weights if the node is the result of the decompression subgraph
+std::shared_ptr<ngraph::Node> getWeightsDecompressionConvert(const std::shared_ptr<ngraph::Node>& node) {
+    auto parent = node;
+    if (ngraph::is_type<ngraph::opset1::Reshape>(parent))
+        parent = parent->get_input_node_shared_ptr(0);
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(parent))
+        return nullptr;
+    parent = parent->get_input_node_shared_ptr(0);
+    if (ngraph::is_type<ngraph::opset1::Subtract>(parent))
+        parent = parent->get_input_node_shared_ptr(0);
+    return ov::intel_cpu::isWeightsDecompressionConvert(parent) ? parent : nullptr;
+}
+
+}   // namespace
+
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant, ngraph::opset1::Multiply, ngraph::opset1::Reshape>();
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -29,6 +48,12 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         auto fc_input_a = pattern_map.at(activations_m);
         auto fc_input_b = pattern_map.at(weights_m);
 
+        // The second input has to be Constant or the decompression of the compressed weights
+        const auto decompression_convert = getWeightsDecompressionConvert(fc_input_b.get_node_shared_ptr());
+        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) && !decompression_convert) {
+            return false;
+        }
+
         auto shape_a = fc_input_a.get_partial_shape();
         auto shape_b = fc_input_b.get_partial_shape();
         NGRAPH_CHECK(shape_b.is_static());
@@ -44,8 +69,7 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
-            std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
+        if (std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
         /*
@@ -133,9 +157,50 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         // Transferring from MatMul representation: [B, I, K] * [B, K, O] = [B, I, O]
         // to FullyConnected representation: [I, K] * [K, O] = [I, O]
 
+        /*
+         *  create_transposed_decompression function rebuilds the decompression subgraph on the transposed constants
+         *  instead of the transposition of its result, so FullyConnected still takes the compressed weights.
+         *  The decompression parameters are broadcast to the weights, so they are aligned to the weights rank first.
+         */
+
+        auto create_transposed_decompression = [&](const ngraph::Output<ngraph::Node>& node) {
+            const auto multiply = node.get_node_shared_ptr();
+            const auto subtract = std::dynamic_pointer_cast<ngraph::opset1::Subtract>(multiply->get_input_node_shared_ptr(0));
+            const auto name = matmul->get_friendly_name() + "/transpose_b";
+
+            auto transpose_param = [&](const ngraph::Output<ngraph::Node>& param) {
+                auto shape = param.get_shape();
+                shape.insert(shape.begin(), static_cast<size_t>(rank_b) - shape.size(), 1);
+                auto reshape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ shape.size() }, shape);
+                auto aligned = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(param, reshape_const, false);
+                auto transpose = create_transpose(aligned, name);
+                new_ops.push_back(transpose);
+                return transpose;
+            };
+
+            auto convert = std::make_shared<ngraph::opset1::Convert>(create_transpose(decompression_convert->input_value(0), name),
+                                                                     decompression_convert->get_output_element_type(0));
+            ngraph::copy_runtime_info(decompression_convert, convert);
+            ov::disable_constant_folding(convert);
+            new_ops.push_back(convert);
+            std::shared_ptr<ngraph::Node> decompressed = convert;
+            if (subtract) {
+                decompressed = std::make_shared<ngraph::opset1::Subtract>(decompressed, transpose_param(subtract->input_value(1)));
+                new_ops.push_back(decompressed);
+            }
+            decompressed = std::make_shared<ngraph::opset1::Multiply>(decompressed, transpose_param(multiply->input_value(1)));
+            decompressed->set_friendly_name(name);
+            return decompressed;
+        };
+
         // Weights normalization
         if (!matmul->get_transpose_b()) {
-            fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
+            // the groups are not supported in the transposed weights, so the decompression is always the Multiply here
+            if (decompression_convert && rank_b == 2 && ngraph::is_type<ngraph::opset1::Multiply>(fc_input_b.get_node())) {
+                fc_input_b = create_transposed_decompression(fc_input_b);
+            } else {
+                fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
+            }
             new_ops.push_back(fc_input_b.get_node_shared_ptr());
         }
 
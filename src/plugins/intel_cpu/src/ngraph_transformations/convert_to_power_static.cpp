@@ -12,6 +12,7 @@
 #include <ngraph/pattern/op/or.hpp>
 #include "op/power_static.hpp"
 #include "op/fully_connected.hpp"
+#include "mark_weights_decompression.hpp"
 #include "utils/general_utils.h"
 
 namespace {
@@ -40,6 +41,12 @@ bool isConvertableToPowerStatic(const std::shared_ptr<BaseOp> &node) {
     auto input_rank = node->get_input_partial_shape(nonConstPort).rank();
     if (input_rank.is_dynamic())
         return false;
+    // the decompression of the compressed weights is fused into FullyConnected as is
+    const auto nonConstInput = node->get_input_node_shared_ptr(nonConstPort);
+    if (ov::intel_cpu::isWeightsDecompressionConvert(nonConstInput) ||
+        (ngraph::is_type<ngraph::opset1::Subtract>(nonConstInput) &&
+         ov::intel_cpu::isWeightsDecompressionConvert(nonConstInput->get_input_node_shared_ptr(0))))
+        return false;
     auto const_shape = node->get_input_shape(constPort);
     return ngraph::shape_size(const_shape) == 1 &&
            input_rank.get_length() >= const_shape.size() &&
@@ -0,0 +1,112 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_weights_decompression.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+NGRAPH_RTTI_DEFINITION(ov::intel_cpu::MarkWeightsDecompression, "MarkWeightsDecompression", 0);
+NGRAPH_RTTI_DEFINITION(ov::intel_cpu::MarkEmbeddingTableDecompression, "MarkEmbeddingTableDecompression", 0);
+
+namespace {
+
+// the decompression parameters may still be the converted constants, they are folded later
+bool isConstantPath(const ngraph::Output<ngraph::Node>& output) {
+    const auto node = output.get_node();
+    if (ngraph::is_type<ngraph::opset1::Convert>(node))
+        return ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(0));
+    return ngraph::is_type<ngraph::opset1::Constant>(node);
+}
+
+}   // namespace
+
+ov::intel_cpu::MarkWeightsDecompression::MarkWeightsDecompression() {
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(
+        ngraph::pattern::type_matches_any({ngraph::element::u8, ngraph::element::i8, ngraph::element::u4, ngraph::element::i4}));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights_m}, ngraph::pattern::consumers_count(1));
+    auto subtract_m = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({convert_m, ngraph::pattern::any_input()},
+                                                                           ngraph::pattern::consumers_count(1));
+    auto scaled_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{convert_m, subtract_m});
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({scaled_m, ngraph::pattern::any_input()},
+                                                                           ngraph::pattern::consumers_count(1));
+    auto reshape_m = ngraph::pattern::wrap_type<ngraph::opset1::Reshape>({multiply_m, ngraph::pattern::wrap_type<ngraph::opset1::Constant>()},
+                                                                         ngraph::pattern::consumers_count(1));
+    auto decompressed_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{multiply_m, reshape_m});
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ngraph::pattern::any_input(), decompressed_m});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto convert = pattern_map.at(convert_m).get_node_shared_ptr();
+        const auto multiply = pattern_map.at(multiply_m).get_node_shared_ptr();
+        if (convert->get_output_element_type(0) != ngraph::element::f32 || !isConstantPath(multiply->input_value(1)))
+            return false;
+
+        const auto subtract = pattern_map.find(subtract_m);
+        if (subtract != pattern_map.end() && !isConstantPath(subtract->second.get_node()->input_value(1)))
+            return false;
+
+        // FullyConnected takes the [N, K] weights, so the groups can't be split out of the transposed ones
+        if (pattern_map.count(reshape_m)) {
+            const auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(m.get_match_root());
+            if (!matmul || !matmul->get_transpose_b() || convert->get_output_partial_shape(0).rank() != 3 ||
+                pattern_map.at(reshape_m).get_partial_shape().rank() != 2)
+                return false;
+        }
+
+        ov::disable_constant_folding(convert);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, "MarkWeightsDecompression");
+    this->register_matcher(m, callback);
+}
+
+ov::intel_cpu::MarkEmbeddingTableDecompression::MarkEmbeddingTableDecompression() {
+    auto table_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(
+        ngraph::pattern::type_matches_any({ngraph::element::u8, ngraph::element::i8, ngraph::element::u4, ngraph::element::i4}));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({table_m}, ngraph::pattern::consumers_count(1));
+    auto subtract_m = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({convert_m, ngraph::pattern::any_input()},
+                                                                           ngraph::pattern::consumers_count(1));
+    auto scaled_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{convert_m, subtract_m});
+    // the embedding ops have the optional inputs, so the consumer is checked in the callback
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({scaled_m, ngraph::pattern::any_input()},
+                                                                           ngraph::pattern::consumers_count(1));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto convert = pattern_map.at(convert_m).get_node_shared_ptr();
+        const auto multiply = pattern_map.at(multiply_m).get_node_shared_ptr();
+        if (convert->get_output_element_type(0) != ngraph::element::f32 || !isConstantPath(multiply->input_value(1)))
+            return false;
+
+        const auto subtract = pattern_map.find(subtract_m);
+        if (subtract != pattern_map.end() && !isConstantPath(subtract->second.get_node()->input_value(1)))
+            return false;
+
+        const auto consumer = *multiply->get_output_target_inputs(0).begin();
+        const auto embedding = consumer.get_node();
+        if (consumer.get_index() != 0 ||
+            !(ngraph::is_type<ngraph::opset3::EmbeddingBagOffsetsSum>(embedding) || ngraph::is_type<ngraph::opset3::EmbeddingBagPackedSum>(embedding) ||
+              ngraph::is_type<ngraph::opset3::EmbeddingSegmentsSum>(embedding)))
+            return false;
+        // the row-wise decompression is supported for the [V, D] tables
+        if (convert->get_output_partial_shape(0).rank() != 2)
+            return false;
+
+        ov::disable_constant_folding(convert);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(multiply_m, "MarkEmbeddingTableDecompression");
+    this->register_matcher(m, callback);
+}
+
+bool ov::intel_cpu::isWeightsDecompressionConvert(const std::shared_ptr<const ov::Node>& node) {
+    return ngraph::is_type<ngraph::opset1::Convert>(node) &&
+           ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(0)) &&
+           node->get_rt_info().count(ov::pass::DisableConstantFolding::get_type_info_static());
+}
@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface MarkWeightsDecompression
+ * @brief Disables the constant folding of the Convert in the decompression subgraph of the MatMul weights:
+ *
+ *   Constant(u8/i8/u4/i4)
+ *           |
+ *        Convert   [Constant]
+ *            \      /
+ *           [Subtract]   Constant
+ *                \       /
+ *                Multiply
+ *                   |
+ *              [Reshape]
+ *                   |
+ *                 MatMul
+ *
+ * The subgraph is fused into FullyConnected on the plugin side, so the weights stay compressed in memory.
+ * The Reshape of [N, G, K / G] weights to [N, K] is the group-wise decompression, it's supported only with transposed weights.
+ */
+class MarkWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkWeightsDecompression();
+};
+
+/**
+ * @interface MarkEmbeddingTableDecompression
+ * @brief Disables the constant folding of the Convert in the row-wise decompression subgraph of the embedding table:
+ *
+ *   Constant(u8/i8/u4/i4)
+ *           |
+ *        Convert   [Constant]
+ *            \      /
+ *           [Subtract]   Constant
+ *                \       /
+ *                Multiply
+ *                   |
+ *   EmbeddingBagOffsetsSum / EmbeddingBagPackedSum / EmbeddingSegmentsSum
+ *
+ * The subgraph is fused into the embedding node on the plugin side, so the table stays compressed in memory.
+ */
+class MarkEmbeddingTableDecompression: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkEmbeddingTableDecompression();
+};
+
+/**
+ * @brief Checks if the node is the Convert marked by MarkWeightsDecompression or MarkEmbeddingTableDecompression
+ */
+bool isWeightsDecompressionConvert(const std::shared_ptr<const ov::Node>& node);
+
+}   // namespace intel_cpu
+}   // namespace ov
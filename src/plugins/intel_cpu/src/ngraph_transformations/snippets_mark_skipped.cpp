@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "snippets_mark_skipped.hpp"
+#include "mark_weights_decompression.hpp"
 #include <snippets/pass/collapse_subgraph.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <utils/general_utils.h>
@@ -305,6 +306,10 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
         if (ngraph::op::is_parameter(node)) {
             SetNodeFusingType(node, NodeFusingType::IgnoredAfterInputs);
             continue;
+        } else if (isWeightsDecompressionConvert(node)) {
+            // The weights decompression chain is fused into FullyConnected
+            SetNodeFusingType(node, NodeFusingType::IgnoredAfterInputs);
+            continue;
         } else if (isSuitableConvolutionParent(node)) {
             // Initiate fusing chain
             SetNodeFusingType(node, NodeFusingType::FusedWithConvolution);
@@ -0,0 +1,316 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft_plan.h"
+
+#include <cmath>
+#include <ie_common.h>
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+#include <common/primitive_hashing_utils.hpp>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+size_t FFTKey::hash() const {
+    using namespace dnnl::impl::primitive_hashing;
+    size_t seed = 0;
+    seed = hash_combine(seed, length);
+    seed = hash_combine(seed, inverse);
+    return seed;
+}
+
+bool FFTKey::operator==(const FFTKey& rhs) const {
+    return length == rhs.length && inverse == rhs.inverse;
+}
+
+namespace {
+using complex_t = FFTPlan::complex_t;
+
+// std::complex multiplication handles inf/nan cases with the library call, which blocks the vectorization
+inline complex_t mul(const complex_t& lhs, const complex_t& rhs) {
+    return {lhs.real() * rhs.real() - lhs.imag() * rhs.imag(), lhs.real() * rhs.imag() + lhs.imag() * rhs.real()};
+}
+
+// multiplication by -i (forward) or i (inverse)
+inline complex_t rotate(const complex_t& value, bool inverse) {
+    return inverse ? complex_t{-value.imag(), value.real()} : complex_t{value.imag(), -value.real()};
+}
+
+inline complex_t rootOfUnity(size_t numerator, size_t denominator, bool inverse) {
+    const double PI = 3.141592653589793238462643;
+    const double angle = 2.0 * PI * static_cast<double>(numerator) / static_cast<double>(denominator);
+    return {static_cast<float>(std::cos(angle)), static_cast<float>(inverse ? std::sin(angle) : -std::sin(angle))};
+}
+
+// number of the interleaved sequences processed by a task
+constexpr size_t strideBlock = 64;
+// the stages are executed in parallel starting from this number of the complex values
+constexpr size_t parallelThreshold = 1 << 14;
+}  // namespace
+
+FFTPlan::FFTPlan(size_t length, bool inverse) : n(length), inverse(inverse) {
+    if (n == 0)
+        IE_THROW() << "FFT plan can not be created for the zero length";
+
+    std::vector<size_t> radices;
+    size_t rest = n;
+    while (rest % 4 == 0) {
+        radices.push_back(4);
+        rest /= 4;
+    }
+    for (size_t radix = 2; radix <= maxRadix && rest > 1; ++radix) {
+        while (rest % radix == 0) {
+            radices.push_back(radix);
+            rest /= radix;
+        }
+    }
+
+    if (rest > 1) {
+        // Bluestein: the DFT is expressed as the circular convolution of the power-of-two length
+        size_t convolutionLength = 1;
+        while (convolutionLength < 2 * n - 1)
+            convolutionLength *= 2;
+        convolutionPlan = std::make_shared<FFTPlan>(convolutionLength, false);
+
+        chirp.resize(n);
+        for (size_t k = 0; k < n; ++k) {
+            // exp(-+ i * pi * k^2 / n) with k^2 reduced to avoid the precision loss
+            const auto square = static_cast<size_t>((static_cast<uint64_t>(k) * k) % (2 * n));
+            chirp[k] = rootOfUnity(square, 2 * n, inverse);
+        }
+
+        kernel.assign(convolutionLength, complex_t{0.f, 0.f});
+        kernel[0] = std::conj(chirp[0]);
+        for (size_t k = 1; k < n; ++k) {
+            kernel[k] = std::conj(chirp[k]);
+            kernel[convolutionLength - k] = std::conj(chirp[k]);
+        }
+        std::vector<complex_t> scratch(convolutionPlan->scratchSize());
+        convolutionPlan->execute(kernel.data(), scratch.data());
+        // normalization of the inverse transform of the convolution result
+        for (auto& value : kernel)
+            value /= static_cast<float>(convolutionLength);
+        return;
+    }
+
+    size_t stride = 1;
+    rootsOfUnity.resize(maxRadix + 1);
+    for (auto radix : radices) {
+        Stage stage;
+        stage.radix = radix;
+        stage.stride = stride;
+        stage.length = n / stride;
+        const size_t m = stage.length / radix;
+        stage.twiddles.resize(m * (radix - 1));
+        for (size_t j = 0; j < m; ++j) {
+            for (size_t k = 1; k < radix; ++k) {
+                stage.twiddles[j * (radix - 1) + k - 1] = rootOfUnity(j * k, stage.length, inverse);
+            }
+        }
+        stages.push_back(std::move(stage));
+
+        if (radix > 5 && rootsOfUnity[radix].empty()) {
+            rootsOfUnity[radix].resize(radix * radix);
+            for (size_t r = 0; r < radix; ++r) {
+                for (size_t k = 0; k < radix; ++k) {
+                    rootsOfUnity[radix][r * radix + k] = rootOfUnity((r * k) % radix, radix, inverse);
+                }
+            }
+        }
+        stride *= radix;
+    }
+}
+
+size_t FFTPlan::scratchSize() const {
+    return convolutionPlan ? convolutionPlan->length() + convolutionPlan->scratchSize() : n;
+}
+
+void FFTPlan::execute(complex_t* data, complex_t* scratch, bool parallelize) const {
+    if (convolutionPlan) {
+        executeBluestein(data, scratch, parallelize);
+    } else {
+        executeStockham(data, scratch, parallelize);
+    }
+}
+
+/*
+ * Stage of the Stockham autosort algorithm: the sequences of the stage length interleaved with the stride
+ * are split into radix subsequences, so the result of the stage is the radix times more sequences
+ * of the radix times smaller length:
+ *   y[i + stride * (radix * j + k)] = w^(j * k) * sum_r x[i + stride * (j + r * m)] * e^(-+2 * pi * i * r * k / radix)
+ */
+template <>
+void FFTPlan::butterfly<2>(const Stage& stage, const complex_t* x, complex_t* y, size_t j, size_t begin, size_t end) const {
+    const size_t s = stage.stride;
+    const size_t m = stage.length / 2;
+    const complex_t w1 = stage.twiddles[j];
+    const complex_t* x0 = x + s * j;
+    const complex_t* x1 = x + s * (j + m);
+    complex_t* y0 = y + s * (2 * j);
+    complex_t* y1 = y + s * (2 * j + 1);
+    for (size_t i = begin; i < end; ++i) {
+        const complex_t a0 = x0[i];
+        const complex_t a1 = x1[i];
+        y0[i] = a0 + a1;
+        y1[i] = mul(a0 - a1, w1);
+    }
+}
+
+template <>
+void FFTPlan::butterfly<3>(const Stage& stage, const complex_t* x, complex_t* y, size_t j, size_t begin, size_t end) const {
+    const float sin60 = 0.866025403784438646763723f;
+    const size_t s = stage.stride;
+    const size_t m = stage.length / 3;
+    const complex_t w1 = stage.twiddles[j * 2];
+    const complex_t w2 = stage.twiddles[j * 2 + 1];
+    const complex_t* x0 = x + s * j;
+    const complex_t* x1 = x + s * (j + m);
+    const complex_t* x2 = x + s * (j + 2 * m);
+    complex_t* y0 = y + s * (3 * j);
+    complex_t* y1 = y + s * (3 * j + 1);
+    complex_t* y2 = y + s * (3 * j + 2);
+    for (size_t i = begin; i < end; ++i) {
+        const complex_t a0 = x0[i];
+        const complex_t sum = x1[i] + x2[i];
+        const complex_t diff = rotate(x1[i] - x2[i], inverse) * sin60;
+        const complex_t t = a0 - sum * 0.5f;
+        y0[i] = a0 + sum;
+        y1[i] = mul(t + diff, w1);
+        y2[i] = mul(t - diff, w2);
+    }
+}
+
+template <>
+void FFTPlan::butterfly<4>(const Stage& stage, const complex_t* x, complex_t* y, size_t j, size_t begin, size_t end) const {
+    const size_t s = stage.stride;
+    const size_t m = stage.length / 4;
+    const complex_t w1 = stage.twiddles[j * 3];
+    const complex_t w2 = stage.twiddles[j * 3 + 1];
+    const complex_t w3 = stage.twiddles[j * 3 + 2];
+    const complex_t* x0 = x + s * j;
+    const complex_t* x1 = x + s * (j + m);
+    const complex_t* x2 = x + s * (j + 2 * m);
+    const complex_t* x3 = x + s * (j + 3 * m);
+    complex_t* y0 = y + s * (4 * j);
+    complex_t* y1 = y + s * (4 * j + 1);
+    complex_t* y2 = y + s * (4 * j + 2);
+    complex_t* y3 = y + s * (4 * j + 3);
+    for (size_t i = begin; i < end; ++i) {
+        const complex_t t0 = x0[i] + x2[i];
+        const complex_t t1 = x0[i] - x2[i];
+        const complex_t t2 = x1[i] + x3[i];
+        const complex_t t3 = rotate(x1[i] - x3[i], inverse);
+        y0[i] = t0 + t2;
+        y1[i] = mul(t1 + t3, w1);
+        y2[i] = mul(t0 - t2, w2);
+        y3[i] = mul(t1 - t3, w3);
+    }
+}
+
+template <>
+void FFTPlan::butterfly<5>(const Stage& stage, const complex_t* x, complex_t* y, size_t j, size_t begin, size_t end) const {
+    const float cos72 = 0.309016994374947424102293f;
+    const float cos144 = -0.809016994374947424102293f;
+    const float sin72 = 0.951056516295153572116439f;
+    const float sin144 = 0.587785252292473129168706f;
+    const size_t s = stage.stride;
+    const size_t m = stage.length / 5;
+    const complex_t* twiddles = stage.twiddles.data() + j * 4;
+    const complex_t* x0 = x + s * j;
+    complex_t* y0 = y + s * (5 * j);
+    for (size_t i = begin; i < end; ++i) {
+        const complex_t a0 = x0[i];
+        const complex_t a1 = x0[i + s * m];
+        const complex_t a2 = x0[i + s * 2 * m];
+        const complex_t a3 = x0[i + s * 3 * m];
+        const complex_t a4 = x0[i + s * 4 * m];
+        const complex_t sum1 = a1 + a4;
+        const complex_t sum2 = a2 + a3;
+        const complex_t diff1 = rotate(a1 - a4, inverse);
+        const complex_t diff2 = rotate(a2 - a3, inverse);
+        const complex_t t1 = a0 + sum1 * cos72 + sum2 * cos144;
+        const complex_t t2 = a0 + sum1 * cos144 + sum2 * cos72;
+        const complex_t u1 = diff1 * sin72 + diff2 * sin144;
+        const complex_t u2 = diff1 * sin144 - diff2 * sin72;
+        y0[i] = a0 + sum1 + sum2;
+        y0[i + s] = mul(t1 + u1, twiddles[0]);
+        y0[i + 2 * s] = mul(t2 + u2, twiddles[1]);
+        y0[i + 3 * s] = mul(t2 - u2, twiddles[2]);
+        y0[i + 4 * s] = mul(t1 - u1, twiddles[3]);
+    }
+}
+
+void FFTPlan::butterflyGeneric(const Stage& stage, const complex_t* x, complex_t* y, size_t j, size_t begin, size_t end) const {
+    const size_t radix = stage.radix;
+    const size_t s = stage.stride;
+    const size_t m = stage.length / radix;
+    const auto& roots = rootsOfUnity[radix];
+    const complex_t* twiddles = stage.twiddles.data() + j * (radix - 1);
+    for (size_t k = 0; k < radix; ++k) {
+        complex_t* yk = y + s * (radix * j + k);
+        const complex_t* root = roots.data() + k;
+        for (size_t i = begin; i < end; ++i) {
+            complex_t sum = x[i + s * j];
+            for (size_t r = 1; r < radix; ++r) {
+                sum += mul(x[i + s * (j + r * m)], root[r * radix]);
+            }
+            yk[i] = k ? mul(sum, twiddles[k - 1]) : sum;
+        }
+    }
+}
+
+void FFTPlan::executeStockham(complex_t* data, complex_t* scratch, bool parallelize) const {
+    complex_t* x = data;
+    complex_t* y = scratch;
+    for (const auto& stage : stages) {
+        auto butterflies = [&](size_t j, size_t begin, size_t end) {
+            switch (stage.radix) {
+            case 2: butterfly<2>(stage, x, y, j, begin, end); break;
+            case 3: butterfly<3>(stage, x, y, j, begin, end); break;
+            case 4: butterfly<4>(stage, x, y, j, begin, end); break;
+            case 5: butterfly<5>(stage, x, y, j, begin, end); break;
+            default: butterflyGeneric(stage, x, y, j, begin, end); break;
+            }
+        };
+        const size_t m = stage.length / stage.radix;
+        if (parallelize && n >= parallelThreshold) {
+            // the last stages have a few long interleaved sequences, so these are split into the blocks
+            const size_t blocks = div_up(stage.stride, strideBlock);
+            parallel_for2d(m, blocks, [&](size_t j, size_t block) {
+                butterflies(j, block * strideBlock, std::min((block + 1) * strideBlock, stage.stride));
+            });
+        } else {
+            for (size_t j = 0; j < m; ++j)
+                butterflies(j, 0, stage.stride);
+        }
+        std::swap(x, y);
+    }
+    if (x != data)
+        std::copy(x, x + n, data);
+}
+
+void FFTPlan::executeBluestein(complex_t* data, complex_t* scratch, bool parallelize) const {
+    const size_t convolutionLength = convolutionPlan->length();
+    complex_t* buffer = scratch;
+    complex_t* convolutionScratch = scratch + convolutionLength;
+
+    for (size_t k = 0; k < n; ++k)
+        buffer[k] = mul(data[k], chirp[k]);
+    std::fill(buffer + n, buffer + convolutionLength, complex_t{0.f, 0.f});
+
+    convolutionPlan->execute(buffer, convolutionScratch, parallelize);
+    // the inverse transform is computed by the forward one of the conjugated values
+    for (size_t k = 0; k < convolutionLength; ++k)
+        buffer[k] = std::conj(mul(buffer[k], kernel[k]));
+    convolutionPlan->execute(buffer, convolutionScratch, parallelize);
+
+    for (size_t k = 0; k < n; ++k)
+        data[k] = mul(std::conj(buffer[k]), chirp[k]);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
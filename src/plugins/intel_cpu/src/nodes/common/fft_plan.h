@@ -0,0 +1,74 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <complex>
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+struct FFTKey {
+    size_t length;
+    bool inverse;
+
+    size_t hash() const;
+    bool operator==(const FFTKey& rhs) const;
+};
+
+/**
+ * @brief Precomputed complex DFT of the given length (the twiddle factors of all the stages).
+ * Lengths factorized into small primes use the mixed-radix Stockham algorithm (natural order, no bit reversal,
+ * contiguous innermost loops for the vectorization), lengths with a large prime factor use the Bluestein algorithm
+ * on top of the power-of-two plan. The inverse transform is not normalized.
+ */
+class FFTPlan {
+public:
+    using Ptr = std::shared_ptr<const FFTPlan>;
+    using complex_t = std::complex<float>;
+
+    FFTPlan(size_t length, bool inverse);
+
+    size_t length() const {
+        return n;
+    }
+    // number of complex values to pass as the scratch buffer to execute
+    size_t scratchSize() const;
+    // in-place transform of the interleaved complex data, parallel execution is worth for the large lengths only
+    void execute(complex_t* data, complex_t* scratch, bool parallelize = false) const;
+
+    // the largest prime factor executed by the mixed-radix algorithm, otherwise Bluestein is used
+    static constexpr size_t maxRadix = 13;
+
+private:
+    struct Stage {
+        size_t radix;
+        size_t stride;                  // number of the already transformed interleaved sequences
+        size_t length;                  // length of the sequences transformed at the stage
+        std::vector<complex_t> twiddles;  // [length / radix][radix - 1]
+    };
+
+    void executeStockham(complex_t* data, complex_t* scratch, bool parallelize) const;
+    void executeBluestein(complex_t* data, complex_t* scratch, bool parallelize) const;
+
+    template <size_t radix>
+    void butterfly(const Stage& stage, const complex_t* x, complex_t* y, size_t j, size_t begin, size_t end) const;
+    void butterflyGeneric(const Stage& stage, const complex_t* x, complex_t* y, size_t j, size_t begin, size_t end) const;
+
+    size_t n;
+    bool inverse;
+    std::vector<Stage> stages;
+    // roots of unity for the generic radix butterflies, [radix][radix] per distinct radix
+    std::vector<std::vector<complex_t>> rootsOfUnity;
+
+    // Bluestein: chirp, transformed convolution kernel (normalized) and the power-of-two plan
+    std::vector<complex_t> chirp;
+    std::vector<complex_t> kernel;
+    std::shared_ptr<FFTPlan> convolutionPlan;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <numeric>
 #include <extension_utils.h>
 
 #include "dft.h"
@@ -106,42 +107,6 @@ void MKLDNNDFTNode::initSupportedPrimitiveDescriptors() {
 }
 
 namespace {
-inline float getRealFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
-    return lhsReal * rhsReal - lhsImag * rhsImag;
-}
-
-inline float getImaginaryFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
-    return lhsReal * rhsImag + lhsImag * rhsReal;
-}
-
-/*
-    Returns true while we can iterate
-    Specified axis is skipped in counters   
-*/
-inline bool nextIterationStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange, size_t axis) {
-    auto itCounter = counters.rbegin();
-    auto itWork = iterationRange.rbegin();
-
-    while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-        if (std::distance(itCounter, counters.rend()) == axis + 1) {
-            ++itCounter;
-            ++itWork;
-            continue;
-        }
-        *itCounter = (*itCounter + 1) % *itWork;
-        if (*itCounter != 0) {
-            return true;
-        }
-        ++itCounter;
-        ++itWork;
-    }
-    return false;
-}
-
-inline bool IsPowerOfTwo(size_t n) {
-    return (n != 0) && (n & (n - 1)) == 0;
-}
-
 inline bool copyStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
     auto itCounter = counters.rbegin();
     auto itWork = iterationRange.rbegin();
@@ -238,13 +203,6 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
     std::sort(axes.begin(), axes.end());
 
     outputShape = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
-    for (size_t axis : axes) {
-        size_t nComplex = outputShape[axis];
-        // FFT uses different twiddle factors
-        if (twiddlesMap.find(nComplex) == twiddlesMap.end() && !IsPowerOfTwo(nComplex)) {
-            twiddlesMap[nComplex] = generateTwiddles(nComplex);
-        }
-    }
 
     auto inputDataEdge = getParentEdgeAt(DATA_INDEX);
     auto outputDataEdge = getChildEdgeAt(0);
@@ -262,163 +220,76 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
 
     // 1d case
     if (inputDataEdge->getMemory().GetShape().getRank() == 2) {
-        size_t nComplex = outputShape[0];
-        if (IsPowerOfTwo(nComplex)) {
-            fft(output, nComplex * 2, true);
-        } else {
-            naiveDFT(output, nComplex * 2);
-        }
+        const auto& plan = *plans.at(outputShape[0]);
+        std::vector<FFTPlan::complex_t> scratch(plan.scratchSize());
+        dft1d(plan, reinterpret_cast<FFTPlan::complex_t*>(output), scratch.data(), true);
     } else {
         dftNd(output, outputStrides);
     }
 }
 
-void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStrides) const {
-    const std::vector<size_t> iterationRange(outputShape.begin(), outputShape.end() - 1);
-    const size_t lastDimIndex = iterationRange.size() - 1;
-    for (size_t axisIndex = 0; axisIndex < axes.size(); ++axisIndex) {
-        const size_t currentAxis = axes[axisIndex];
-        const size_t outputComplexLen = outputShape[currentAxis];
-        const size_t outputLen = outputComplexLen * 2;
-
-        std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
-            size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
-            do {
-                parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen);
-                    auto parallelIterationCounter = iterationCounter;
-                    parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                    fft(gatheredData.data(), outputLen);
-                    applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                });
-                iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        } else {
-            std::vector<float> gatheredData(outputLen);
-            do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
+void MKLDNNDFTNode::dft1d(const FFTPlan& plan, FFTPlan::complex_t* data, FFTPlan::complex_t* scratch, bool parallelize) const {
+    plan.execute(data, scratch, parallelize);
+    if (inverse) {
+        const size_t length = plan.length();
+        const float scale = 1.f / length;
+        for (size_t k = 0; k < length; ++k) {
+            data[k] *= scale;
         }
     }
 }
 
-/* Cooley Tukey implementation of FFT */
-void MKLDNNDFTNode::fft(float* data, int64_t dataLength, bool parallelize) const {
-    static int cacheSizeL3 = utils::get_cache_size(3, false);
-    static int elementsPerCacheLine = cacheSizeL3 / sizeof(float);
-    std::vector<float> bufferVector(dataLength * 2, 0);
-    float* buffer = bufferVector.data();
-    cpu_memcpy(buffer, data, dataLength * sizeof(float));
-
-    size_t nComplex = dataLength / 2;
-    float* inBufferStart = buffer + dataLength;
-    float* outBufferStart = buffer;
-
-    auto blockIteration = [&] (const size_t block, const size_t blockSize, const size_t nextIterationBlockSize, const float anglePart) {
-        float* curInpBufferPtr = inBufferStart + block * blockSize;
-        float* curOutBufferPtr = outBufferStart + block * nextIterationBlockSize;
-
-        const float angle = anglePart * block;
-        const float twiddleReal = std::cos(angle);
-        const float twiddleImag = -std::sin(angle);
-        for (int64_t pair = 0; pair < blockSize / 2; pair += 2) {
-            const float evenReal = curInpBufferPtr[pair];
-            const float evenImag = curInpBufferPtr[pair + 1];
-
-            const float oddReal = curInpBufferPtr[(blockSize / 2 + pair)];
-            const float oddImag = curInpBufferPtr[(blockSize / 2 + pair) + 1];
-
-            const float twiddledOddReal = getRealFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-            const float twiddledOddImag = getImaginaryFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-
-            curOutBufferPtr[pair] = evenReal + twiddledOddReal;
-            curOutBufferPtr[pair + 1] = evenImag + twiddledOddImag;
-
-            curOutBufferPtr[nComplex + pair] = evenReal - twiddledOddReal;
-            curOutBufferPtr[nComplex + pair + 1] = evenImag - twiddledOddImag;
-        }
-    };
-
-    for (int64_t numBlocks = 1; numBlocks < nComplex; numBlocks *= 2) {
-        const float anglePart = PI / numBlocks * (inverse ? -1 : 1);
-
-        std::swap(inBufferStart, outBufferStart);
-        const int64_t blockSize = dataLength / numBlocks;
-        const int64_t nextIterationBlockSize = blockSize / 2;
-        if (parallelize && blockSize >= 4 * elementsPerCacheLine) {
-            parallel_for(numBlocks, [&] (const size_t block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
-            });
-        } else {
-            for (int64_t block = 0; block < numBlocks; ++block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
+void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStrides) const {
+    // the last dimension holds the real and imaginary parts
+    const size_t rank = outputShape.size() - 1;
+    for (size_t currentAxis : axes) {
+        const size_t length = outputShape[currentAxis];
+        const auto& plan = *plans.at(length);
+        const size_t linesNum = std::accumulate(outputShape.begin(), outputShape.begin() + rank, size_t(1),
+                                                std::multiplies<size_t>()) / length;
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(linesNum, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            std::vector<FFTPlan::complex_t> gatheredData(length);
+            std::vector<FFTPlan::complex_t> scratch(plan.scratchSize());
+            auto* buffer = reinterpret_cast<float*>(gatheredData.data());
+            std::vector<size_t> coords(rank, 0);
+            for (size_t line = start; line < end; ++line) {
+                size_t rest = line;
+                for (size_t dim = rank; dim-- > 0;) {
+                    if (dim == currentAxis)
+                        continue;
+                    coords[dim] = rest % outputShape[dim];
+                    rest /= outputShape[dim];
+                }
+                gatherToBufferND(buffer, output, currentAxis, coords, outputShape, outputStrides);
+                dft1d(plan, gatheredData.data(), scratch.data());
+                applyBufferND(buffer, output, currentAxis, coords, outputShape, outputStrides);
             }
-        }
-    }
-
-    for (int64_t k = 0; k < dataLength; k++) {
-        if (inverse) {
-            outBufferStart[k] /= nComplex;
-        }
-        data[k] = outBufferStart[k];
+        });
     }
 }
 
-void MKLDNNDFTNode::naiveDFT(float* data, size_t dataLength) const {
-    std::vector<float> outputBuffer(dataLength);
-    const size_t nComplex = dataLength / 2;
-    const auto& twiddles = twiddlesMap.find(nComplex)->second;
-
-    parallel_for(nComplex, [&](size_t k) {
-        float sumReal = 0.0f;
-        float sumImag = 0.0f;
-        for (size_t n = 0; n < nComplex; ++n) {
-            auto it = twiddles[k * nComplex + n];
-            float complexReal = it.first;
-            float complexImag = it.second;
-
-            if (inverse) {
-                complexImag *= -1; // conjugate
-            }
-            float complexProdReal = getRealFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-            float complexProdImag = getImaginaryFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-
-            sumReal += complexProdReal;
-            sumImag += complexProdImag;
-        }
-
-        if (inverse) {
-            sumReal /= nComplex;
-            sumImag /= nComplex;
-        }
-        outputBuffer[k * 2] = sumReal;
-        outputBuffer[k * 2 + 1] = sumImag;
-    });
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
-}
-
-std::vector<std::pair<float, float>> MKLDNNDFTNode::generateTwiddles(size_t n_complex) const {
-    std::vector<std::pair<float, float>> twiddles(n_complex * n_complex);
-    parallel_for(n_complex, [&](const size_t k) {
-        for (size_t n = 0; n < n_complex; ++n) {
-            float phase =  2.0f * PI * static_cast<float>(n * k) / static_cast<float>(n_complex);
-            auto complexReal = std::cos(phase);
-            auto complexImag = -std::sin(phase);
-            twiddles[k * n_complex + n] = std::make_pair(complexReal, complexImag);
-        }
-    });
-    return twiddles;
+void MKLDNNDFTNode::prepareParams() {
+    // the axes are known at the execution only, so preparing the plans for all the dimensions
+    const auto& dims = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    auto cache = getRuntimeCache();
+    auto builder = [](const FFTKey& key) {
+        return std::make_shared<FFTPlan>(key.length, key.inverse);
+    };
+    for (size_t i = 0; i + 1 < dims.size(); ++i) {
+        if (plans.count(dims[i]))
+            continue;
+        plans[dims[i]] = cache->getOrCreate(FFTKey{dims[i], inverse}, builder).first;
+    }
 }
 
 bool MKLDNNDFTNode::created() const {
     return getType() == DFT;
 }
 
-void MKLDNNDFTNode::createPrimitive() {}
-
-
 REG_MKLDNN_PRIM_FOR(MKLDNNDFTNode, DFT)
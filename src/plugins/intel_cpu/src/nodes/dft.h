@@ -7,6 +7,7 @@
 #include <ie_common.h>
 #include <node.h>
 #include <string>
+#include "common/fft_plan.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -18,7 +19,7 @@ public:
 
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override;
+    void prepareParams() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -26,12 +27,10 @@ public:
 
 private:
     void dftNd(float* output, const std::vector<size_t>& outputStrides) const;
-    void fft(float* data, int64_t dataLength, bool parallelize = false) const;
-    void naiveDFT(float* data, size_t dataLength) const;
+    void dft1d(const FFTPlan& plan, FFTPlan::complex_t* data, FFTPlan::complex_t* scratch, bool parallelize = false) const;
 
-    std::vector<std::pair<float, float>> generateTwiddles(size_t n_complex) const;
-
-    std::unordered_map<size_t, std::vector<std::pair<float, float>>> twiddlesMap;
+    // plans of the transform for the lengths of the output dimensions (any of them may be the axis)
+    std::unordered_map<size_t, FFTPlan::Ptr> plans;
     std::vector<int32_t> axes;
     std::vector<size_t> outputShape;
     std::vector<size_t> inputShape;
@@ -39,7 +38,6 @@ private:
     const size_t DATA_INDEX = 0;
     const size_t AXES_INDEX = 1;
     const size_t SIGNAL_SIZE_INDEX = 2;
-    static constexpr float PI = 3.141592653589793238462643f;
     bool inverse;
 };
 
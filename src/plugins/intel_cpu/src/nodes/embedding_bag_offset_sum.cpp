@@ -44,11 +44,10 @@ void MKLDNNEmbeddingBagOffsetSumNode::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
+    const auto outDataPrecision = getOutputPrecision(inDataPrecision);
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -65,15 +64,17 @@ void MKLDNNEmbeddingBagOffsetSumNode::initSupportedPrimitiveDescriptors() {
     if (inputShapes.size() > DEFAULT_INDEX_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, Precision::I32});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
-        inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
+        inDataConfigurators.push_back({LayoutType::ncsp, outDataPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outDataPrecision}},
+                         getImplType(inDataPrecision, getInputShapeAtPort(EMB_TABLE_IDX).getDims()));
 }
 
 void MKLDNNEmbeddingBagOffsetSumNode::prepareParams() {
     _indicesLen = getParentEdgesAtPort(INDICES_IDX)[0]->getMemory().getStaticDims()[0];
     _offsetsLen = getParentEdgesAtPort(OFFSETS_IDX)[0]->getMemory().getStaticDims()[0];
-    MKLDNNEmbeddingBagSumNode::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    const auto& tableMem = getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory();
+    MKLDNNEmbeddingBagSumNode::prepareParams(tableMem.getStaticDims(), tableMem.getDesc().getPrecision());
 }
 
 void MKLDNNEmbeddingBagOffsetSumNode::initFromInputs() {
@@ -41,11 +41,10 @@ void MKLDNNEmbeddingBagPackedSumNode::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
+    const auto outDataPrecision = getOutputPrecision(inDataPrecision);
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -59,15 +58,17 @@ void MKLDNNEmbeddingBagPackedSumNode::initSupportedPrimitiveDescriptors() {
     std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
                                                        {LayoutType::ncsp, Precision::I32}});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
-        inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
+        inDataConfigurators.push_back({LayoutType::ncsp, outDataPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outDataPrecision}},
+                         getImplType(inDataPrecision, getInputShapeAtPort(EMB_TABLE_IDX).getDims()));
 }
 
 void MKLDNNEmbeddingBagPackedSumNode::prepareParams() {
     _batch = getParentEdgesAtPort(INDICES_IDX)[0]->getMemory().getStaticDims()[0];
     _indicesPerBag = getParentEdgesAtPort(INDICES_IDX)[0]->getMemory().getStaticDims()[1];
-    MKLDNNEmbeddingBagSumNode::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    const auto& tableMem = getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory();
+    MKLDNNEmbeddingBagSumNode::prepareParams(tableMem.getStaticDims(), tableMem.getDesc().getPrecision());
 }
 
 void MKLDNNEmbeddingBagPackedSumNode::initFromInputs() {
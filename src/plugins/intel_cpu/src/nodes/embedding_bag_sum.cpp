@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -10,9 +11,13 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace ov::intel_cpu;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
 
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
@@ -36,11 +41,90 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
-void MKLDNNEmbeddingBagSumNode::prepareParams(const VectorDims& indexStaticShape) {
+void MKLDNNEmbeddingBagSumNode::prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& tablePrecision) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    if (!isJitPrecision(tablePrecision)) {
+        _kernel.reset();
+        return;
+    }
+
+    jEmbeddingBagConfParams jcp;
+    jcp.tablePrecision = tablePrecision;
+    jcp.withWeights = _withWeights;
+    jcp.rowSize = _embDepth;
+    if (_kernel && _kernel->getJcp().tablePrecision == jcp.tablePrecision && _kernel->getJcp().rowSize == jcp.rowSize)
+        return;
+
+    if (x64::mayiuse(x64::avx512_common)) {
+        _kernel.reset(new jitUniEmbeddingBagKernel<x64::avx512_common>(jcp));
+    } else {
+        _kernel.reset(new jitUniEmbeddingBagKernel<x64::avx2>(jcp));
+    }
+    // the rows shorter than the vector are accumulated by the reference code
+    if (_kernel->getProcessedRowSize() == 0) {
+        _kernel.reset();
+        return;
+    }
+    _kernel->create_ker();
+}
+
+bool MKLDNNEmbeddingBagSumNode::isJitPrecision(const InferenceEngine::Precision& tablePrecision) const {
+    if (!x64::mayiuse(x64::avx2))
+        return false;
+    return one_of(tablePrecision, Precision::FP32, Precision::BF16) ||
+           (one_of(tablePrecision, Precision::U8, Precision::I8) && isTableCompressed());
+}
+
+InferenceEngine::Precision MKLDNNEmbeddingBagSumNode::getOutputPrecision(const InferenceEngine::Precision& tablePrecision) const {
+    if (tablePrecision == Precision::BF16 || isTableCompressed())
+        return Precision::FP32;
+    return tablePrecision;
+}
+
+impl_desc_type MKLDNNEmbeddingBagSumNode::getImplType(const InferenceEngine::Precision& tablePrecision, const VectorDims& tableDims) const {
+    if (!isJitPrecision(tablePrecision))
+        return impl_desc_type::ref_any;
+    const bool isAvx512 = x64::mayiuse(x64::avx512_common);
+    // the rows shorter than the vector are accumulated by the reference code (see prepareParams),
+    // the undefined row size is decided on the execution
+    const size_t elPerVec = (isAvx512 ? x64::cpu_isa_traits<x64::avx512_common>::vlen : x64::cpu_isa_traits<x64::avx2>::vlen) / sizeof(float);
+    size_t rowSize = 1lu;
+    for (size_t i = 1lu; i < tableDims.size() && rowSize != Shape::UNDEFINED_DIM; i++) {
+        rowSize = tableDims[i] == Shape::UNDEFINED_DIM ? Shape::UNDEFINED_DIM : rowSize * tableDims[i];
+    }
+    if (rowSize < elPerVec)
+        return impl_desc_type::ref_any;
+    return isAvx512 ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+}
+
+void MKLDNNEmbeddingBagSumNode::prepareBags(size_t bagsNum) {
+    _bags.resize(bagsNum);
+    _bagsWork.resize(bagsNum + 1lu);
+    _bagsWork[0] = 0lu;
+    for (size_t obi = 0lu; obi < bagsNum; obi++) {
+        auto& bag = _bags[obi];
+        bag.weightsIdx = 0;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+        // every bag costs at least the store of the output row
+        _bagsWork[obi + 1lu] = _bagsWork[obi] + (bag.indices != nullptr ? bag.size : 0lu) + 1lu;
+    }
+}
+
+void MKLDNNEmbeddingBagSumNode::splitBags(int ithr, int nthr, size_t& start, size_t& end) const {
+    // The bags sizes of the recommendation models are skewed, so the bags are split by the number of the gathered rows.
+    const size_t bagsNum = _bags.size();
+    const size_t totalWork = _bagsWork.back();
+    auto firstBag = [&](int thr) {
+        const size_t work = totalWork * thr / nthr;
+        return static_cast<size_t>(std::lower_bound(_bagsWork.begin(), _bagsWork.begin() + bagsNum, work) - _bagsWork.begin());
+    };
+    start = firstBag(ithr);
+    end = ithr + 1 == nthr ? bagsNum : firstBag(ithr + 1);
 }
 
 template<typename T>
@@ -48,28 +132,21 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
                                             const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
-    initFromInputs();
-
-    const size_t outputBagsNum = outDataDims[0];
-
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        splitBags(ithr, nthr, start, end);
         if (start >= end)
             return;
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
-
         for (size_t obi = start; obi < end; obi++) {
             size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            const auto& bag = _bags[obi];
+            const int* indices = bag.indices;
+            const size_t indicesSize = bag.size;
+            const bool withWeights = bag.withWeights;
+            int weightsIdx = bag.weightsIdx;
 
             if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
                 size_t inIdx = 0lu;
                 if (indices[inIdx] >= inDataDims[0]) {
                     IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
@@ -115,8 +192,106 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
     parallel_nt(0, threadBody);
 }
 
+namespace {
+
+// Accumulates the [begin, end) part of the rows, the decompression and the per sample weights are applied to every row.
+template<typename T>
+void accumulateRowsRef(const T* table, size_t rowSize, const int* indices, size_t indicesSize, const float* weights,
+                       const float* scales, const float* zpScales, size_t begin, size_t end, float* dst) {
+    std::fill(dst + begin, dst + end, 0.f);
+    for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+        const size_t idx = indices[inIdx];
+        const float weight = weights ? weights[inIdx] : 1.f;
+        const float scale = scales ? scales[idx] * weight : weight;
+        const float zpScale = zpScales ? zpScales[idx] * weight : 0.f;
+        const T* row = table + idx * rowSize;
+        for (size_t i = begin; i < end; i++) {
+            dst[i] += static_cast<float>(row[i]) * scale - zpScale;
+        }
+    }
+}
+
+}   // namespace
+
+void MKLDNNEmbeddingBagSumNode::processDataToFp32(const uint8_t* srcData, const float* weightsData, float* dstData,
+                                                  const InferenceEngine::Precision &srcPrc,
+                                                  const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    const float* scales = isTableCompressed() ? decompressionScales.data() : nullptr;
+    const float* zpScales = isTableCompressed() ? decompressionZeroPointsScaled.data() : nullptr;
+    const size_t kernelRowSize = _kernel ? _kernel->getProcessedRowSize() : 0lu;
+    // the bags without the weights are processed by the same kernel with the unit weight
+    const float unitWeight = 1.f;
+
+    auto accumulateRows = [&](const Bag& bag, const float* weights, size_t begin, float* dst) {
+        switch (srcPrc) {
+            case Precision::FP32:
+                return accumulateRowsRef(reinterpret_cast<const float*>(srcData), _embDepth, bag.indices, bag.size, weights,
+                                         scales, zpScales, begin, _embDepth, dst);
+            case Precision::BF16:
+                return accumulateRowsRef(reinterpret_cast<const bfloat16_t*>(srcData), _embDepth, bag.indices, bag.size, weights,
+                                         scales, zpScales, begin, _embDepth, dst);
+            case Precision::U8:
+                return accumulateRowsRef(srcData, _embDepth, bag.indices, bag.size, weights,
+                                         scales, zpScales, begin, _embDepth, dst);
+            case Precision::I8:
+                return accumulateRowsRef(reinterpret_cast<const int8_t*>(srcData), _embDepth, bag.indices, bag.size, weights,
+                                         scales, zpScales, begin, _embDepth, dst);
+            default:
+                IE_THROW() << msgPrefix << "does not support precision '" << srcPrc.name() << "'";
+        }
+    };
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitBags(ithr, nthr, start, end);
+        if (start >= end)
+            return;
+
+        for (size_t obi = start; obi < end; obi++) {
+            float* dst = dstData + obi * _embDepth;
+            const auto& bag = _bags[obi];
+            if (bag.indices == nullptr) {
+                std::fill(dst, dst + _embDepth, 0.f);
+                continue;
+            }
+            for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                if (bag.indices[inIdx] >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[inIdx]);
+                }
+            }
+            const float* weights = bag.withWeights ? weightsData + bag.weightsIdx : nullptr;
+
+            if (_kernel) {
+                embeddingBagJitExecArgs args;
+                args.table = srcData;
+                args.indices = bag.indices;
+                args.weights = weights ? weights : &unitWeight;
+                args.weightsStrideB = weights ? sizeof(float) : 0lu;
+                args.scales = scales;
+                args.zpScales = zpScales;
+                args.dst = dst;
+                args.indicesNum = bag.size;
+                (*_kernel)(&args);
+            }
+            if (kernelRowSize < _embDepth)
+                accumulateRows(bag, weights, kernelRowSize, dst);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                                         const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
+    initFromInputs();
+    prepareBags(outDims[0]);
+
+    if (_kernel || srcPrc == Precision::BF16 || isTableCompressed()) {
+        return processDataToFp32(srcData, reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), srcPrc, inDims, outDims);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
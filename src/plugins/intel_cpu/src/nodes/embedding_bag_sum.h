@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "kernels/embedding_bag_kernel.hpp"
 #include <string>
 #include <memory>
 #include <vector>
@@ -27,6 +28,14 @@ public:
 
     ~MKLDNNEmbeddingBagSumNode() = default;
 
+    bool isTableCompressed() const {
+        return !decompressionScales.empty();
+    }
+
+    // The row-wise decompression of the u8/i8 table, it's set by the graph optimizer.
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionZeroPointsScaled;
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -36,11 +45,17 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& tablePrecision);
+
+    // The bf16 and the compressed tables are accumulated to f32.
+    InferenceEngine::Precision getOutputPrecision(const InferenceEngine::Precision& tablePrecision) const;
+    impl_desc_type getImplType(const InferenceEngine::Precision& tablePrecision, const VectorDims& tableDims) const;
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+    void processDataToFp32(const uint8_t* srcData, const float* weightsData, float* dstData, const InferenceEngine::Precision &srcPrc,
+                           const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -50,6 +65,24 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+private:
+    struct Bag {
+        const int* indices = nullptr;
+        size_t size = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = false;
+    };
+
+    bool isJitPrecision(const InferenceEngine::Precision& tablePrecision) const;
+    void prepareBags(size_t bagsNum);
+    void splitBags(int ithr, int nthr, size_t& start, size_t& end) const;
+
+    std::vector<Bag> _bags;
+    // The prefix sums of the bags work, the threads get the bags of the equal work.
+    std::vector<size_t> _bagsWork;
+
+    std::shared_ptr<jitEmbeddingBagKernelBase> _kernel;
 };
 
 }   // namespace intel_cpu
@@ -47,11 +47,10 @@ void MKLDNNEmbeddingSegmentsSumNode::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
+    const auto outDataPrecision = getOutputPrecision(inDataPrecision);
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -69,13 +68,15 @@ void MKLDNNEmbeddingSegmentsSumNode::initSupportedPrimitiveDescriptors() {
     if (inputShapes.size() > DEFAULT_INDEX_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, Precision::I32});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
-        inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
+        inDataConfigurators.push_back({LayoutType::ncsp, outDataPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outDataPrecision}},
+                         getImplType(inDataPrecision, getInputShapeAtPort(EMB_TABLE_IDX).getDims()));
 }
 
 void MKLDNNEmbeddingSegmentsSumNode::prepareParams() {
-    MKLDNNEmbeddingBagSumNode::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    const auto& tableMem = getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory();
+    MKLDNNEmbeddingBagSumNode::prepareParams(tableMem.getStaticDims(), tableMem.getDesc().getPrecision());
 }
 
 void MKLDNNEmbeddingSegmentsSumNode::initFromInputs() {
@@ -91,6 +92,18 @@ void MKLDNNEmbeddingSegmentsSumNode::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->GetPtr());
     }
+
+    // The segments are collected in one pass instead of the search over all the segment ids for every output bag.
+    const size_t segmentsNum = numSegments_ > 0 ? numSegments_ : 0lu;
+    segmentsBegin_.assign(segmentsNum, 0lu);
+    segmentsSize_.assign(segmentsNum, 0lu);
+    for (size_t si = 0; si < indicesSize_; si++) {
+        const int segmentId = segmentIds_[si];
+        if (segmentId < 0 || segmentId >= numSegments_)
+            continue;
+        if (segmentsSize_[segmentId]++ == 0lu)
+            segmentsBegin_[segmentId] = si;
+    }
 }
 
 void MKLDNNEmbeddingSegmentsSumNode::getIndices(int embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeight) {
@@ -98,17 +111,12 @@ void MKLDNNEmbeddingSegmentsSumNode::getIndices(int embIndex, const int*& indice
         IE_THROW() << "Invalid embedding bag index.";
 
     indices = nullptr;
-    size = 0;
+    size = segmentsSize_[embIndex];
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    if (size != 0) {
+        indices = indices_ + segmentsBegin_[embIndex];
+        weightsIdx = segmentsBegin_[embIndex];
     }
 
     // Empty bag
@@ -45,6 +45,9 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+    // The first index and the number of the indices of every segment.
+    std::vector<size_t> segmentsBegin_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }   // namespace intel_cpu
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -51,14 +53,24 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
     Indexer refined_box_idx({classes_num, rois_num, 4});
     Indexer refined_score_idx({classes_num, rois_num});
 
-    for (int roi_idx = 0; roi_idx < rois_num; ++roi_idx) {
-        float x0 = boxes[box_idx({roi_idx, 0})];
-        float y0 = boxes[box_idx({roi_idx, 1})];
-        float x1 = boxes[box_idx({roi_idx, 2})];
-        float y1 = boxes[box_idx({roi_idx, 3})];
+    const float weight_x = weights[0];
+    const float weight_y = weights[1];
+    const float weight_w = weights[2];
+    const float weight_h = weights[3];
+
+    // distance between the same roi of the neighbouring classes
+    const int refined_box_stride = 4 * rois_num;
+    const int refined_score_stride = rois_num;
+
+    parallel_for(rois_num, [&](int roi_idx) {
+        const float* box = &boxes[box_idx({roi_idx, 0})];
+        const float x0 = box[0];
+        const float y0 = box[1];
+        const float x1 = box[2];
+        const float y1 = box[3];
 
         if (x1 - x0 <= 0 || y1 - y0 <= 0) {
-            continue;
+            return;
         }
 
         // width & height of box
@@ -68,11 +80,18 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
         const float ctr_x = x0 + 0.5f * ww;
         const float ctr_y = y0 + 0.5f * hh;
 
+        const float* roi_deltas = &deltas[delta_idx({roi_idx, 0, 0})];
+        const float* roi_scores = &scores[score_idx({roi_idx, 0})];
+        float* roi_refined_boxes = &refined_boxes[refined_box_idx({0, roi_idx, 0})];
+        float* roi_refined_areas = &refined_boxes_areas[refined_score_idx({0, roi_idx})];
+        float* roi_refined_scores = &refined_scores[refined_score_idx({0, roi_idx})];
+
+        // the loop body has no branches and no cross-iteration dependencies to be vectorized over the classes
         for (int class_idx = 1; class_idx < classes_num; ++class_idx) {
-            const float dx = deltas[delta_idx({roi_idx, class_idx, 0})] / weights[0];
-            const float dy = deltas[delta_idx({roi_idx, class_idx, 1})] / weights[1];
-            const float d_log_w = deltas[delta_idx({roi_idx, class_idx, 2})] / weights[2];
-            const float d_log_h = deltas[delta_idx({roi_idx, class_idx, 3})] / weights[3];
+            const float dx = roi_deltas[4 * class_idx + 0] / weight_x;
+            const float dy = roi_deltas[4 * class_idx + 1] / weight_y;
+            const float d_log_w = roi_deltas[4 * class_idx + 2] / weight_w;
+            const float d_log_h = roi_deltas[4 * class_idx + 3] / weight_h;
 
             // new center location according to deltas (dx, dy)
             const float pred_ctr_x = dx * ww + ctr_x;
@@ -81,33 +100,28 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
             const float pred_w = std::exp((std::min)(d_log_w, max_delta_log_wh)) * ww;
             const float pred_h = std::exp((std::min)(d_log_h, max_delta_log_wh)) * hh;
 
-            // update upper-left corner location
-            float x0_new = pred_ctr_x - 0.5f * pred_w;
-            float y0_new = pred_ctr_y - 0.5f * pred_h;
-            // update lower-right corner location
-            float x1_new = pred_ctr_x + 0.5f * pred_w - coordinates_offset;
-            float y1_new = pred_ctr_y + 0.5f * pred_h - coordinates_offset;
-
-            // adjust new corner locations to be within the image region,
-            x0_new = std::max<float>(0.0f, x0_new);
-            y0_new = std::max<float>(0.0f, y0_new);
-            x1_new = std::max<float>(0.0f, x1_new);
-            y1_new = std::max<float>(0.0f, y1_new);
+            // update upper-left corner location and lower-right corner location,
+            // adjust new corner locations to be within the image region
+            const float x0_new = (std::max)(0.0f, pred_ctr_x - 0.5f * pred_w);
+            const float y0_new = (std::max)(0.0f, pred_ctr_y - 0.5f * pred_h);
+            const float x1_new = (std::max)(0.0f, pred_ctr_x + 0.5f * pred_w - coordinates_offset);
+            const float y1_new = (std::max)(0.0f, pred_ctr_y + 0.5f * pred_h - coordinates_offset);
 
             // recompute new width & height
             const float box_w = x1_new - x0_new + coordinates_offset;
             const float box_h = y1_new - y0_new + coordinates_offset;
 
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 0})] = x0_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 1})] = y0_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 2})] = x1_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 3})] = y1_new;
+            float* refined_box = roi_refined_boxes + class_idx * refined_box_stride;
+            refined_box[0] = x0_new;
+            refined_box[1] = y0_new;
+            refined_box[2] = x1_new;
+            refined_box[3] = y1_new;
 
-            refined_boxes_areas[refined_score_idx({class_idx, roi_idx})] = box_w * box_h;
+            roi_refined_areas[class_idx * refined_score_stride] = box_w * box_h;
 
-            refined_scores[refined_score_idx({class_idx, roi_idx})] = scores[score_idx({roi_idx, class_idx})];
+            roi_refined_scores[class_idx * refined_score_stride] = roi_scores[class_idx];
         }
-    }
+    });
 }
 
 template <typename T>
@@ -129,42 +143,73 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2,
-                                   const float coordinates_offset = 1) {
-    float xmin1 = decoded_bbox[idx1 * 4 + 0];
-    float ymin1 = decoded_bbox[idx1 * 4 + 1];
-    float xmax1 = decoded_bbox[idx1 * 4 + 2];
-    float ymax1 = decoded_bbox[idx1 * 4 + 3];
-
-    float xmin2 = decoded_bbox[idx2 * 4 + 0];
-    float ymin2 = decoded_bbox[idx2 * 4 + 1];
-    float ymax2 = decoded_bbox[idx2 * 4 + 3];
-    float xmax2 = decoded_bbox[idx2 * 4 + 2];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
+// Boxes kept by NMS in the SoA layout for the vectorized overlap computation
+struct KeptBoxes {
+    explicit KeptBoxes(const int capacity) : data(5 * capacity), capacity(capacity) {}
 
-    float intersect_width  = intersect_xmax - intersect_xmin + coordinates_offset;
-    float intersect_height = intersect_ymax - intersect_ymin + coordinates_offset;
+    void push_back(const float* bbox, const float size) {
+        float* dst = &data[size_];
+        for (int i = 0; i < 4; ++i, dst += capacity)
+            *dst = bbox[i];
+        *dst = size;
+        ++size_;
+    }
 
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
+    int size() const {
+        return size_;
     }
 
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
+    const float* xmin() const { return &data[0]; }
+    const float* ymin() const { return &data[capacity]; }
+    const float* xmax() const { return &data[2 * capacity]; }
+    const float* ymax() const { return &data[3 * capacity]; }
+    const float* sizes() const { return &data[4 * capacity]; }
+
+private:
+    std::vector<float> data;
+    const int capacity;
+    int size_ = 0;
+};
 
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
+// Checks whether the Jaccard overlap of the box with any of the kept boxes exceeds the threshold.
+// The overlaps are computed for the blocks of the kept boxes with no early exit inside the block,
+// so the inner loop is vectorized.
+static inline bool is_suppressed(const float* bbox,
+                                 const float bbox_size,
+                                 const KeptBoxes& kept,
+                                 const float nms_threshold,
+                                 const float coordinates_offset = 1) {
+    constexpr int block_size = 16;
+
+    const float xmin1 = bbox[0];
+    const float ymin1 = bbox[1];
+    const float xmax1 = bbox[2];
+    const float ymax1 = bbox[3];
+
+    const float* xmin2 = kept.xmin();
+    const float* ymin2 = kept.ymin();
+    const float* xmax2 = kept.xmax();
+    const float* ymax2 = kept.ymax();
+    const float* sizes2 = kept.sizes();
+
+    for (int start = 0; start < kept.size(); start += block_size) {
+        const int end = (std::min)(start + block_size, kept.size());
+        int suppressed = 0;
+        for (int k = start; k < end; ++k) {
+            const bool disjoint = xmin2[k] > xmax1 || xmax2[k] < xmin1 || ymin2[k] > ymax1 || ymax2[k] < ymin1;
+
+            const float intersect_width = (std::min)(xmax1, xmax2[k]) - (std::max)(xmin1, xmin2[k]) + coordinates_offset;
+            const float intersect_height = (std::min)(ymax1, ymax2[k]) - (std::max)(ymin1, ymin2[k]) + coordinates_offset;
+            const bool empty = disjoint || intersect_width <= 0 || intersect_height <= 0;
+
+            const float intersect_size = empty ? 0.0f : intersect_width * intersect_height;
+            const float overlap = intersect_size / (bbox_size + sizes2[k] - intersect_size);
+            suppressed |= static_cast<int>(!empty && overlap > nms_threshold);
+        }
+        if (suppressed)
+            return true;
+    }
+    return false;
 }
 
 
@@ -189,30 +234,28 @@ static void nms_cf(const float* conf_data,
 
     int num_output_scores = (pre_nms_topn == -1 ? count : (std::min)(pre_nms_topn, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    if (num_output_scores < count) {
+        std::partial_sort_copy(indices, indices + count,
+                               buffer, buffer + num_output_scores,
+                               ConfidenceComparator(conf_data));
+    } else {
+        std::copy(indices, indices + count, buffer);
+        std::sort(buffer, buffer + count, ConfidenceComparator(conf_data));
+    }
+
+    // the detections over post_nms_topn are dropped anyway and don't suppress the preceding ones
+    const int max_detections = (post_nms_topn == -1 ? num_output_scores : (std::min)(post_nms_topn, num_output_scores));
+    KeptBoxes kept(max_detections);
 
     detections = 0;
-    for (int i = 0; i < num_output_scores; ++i) {
+    for (int i = 0; i < num_output_scores && detections < max_detections; ++i) {
         const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        if (!is_suppressed(&bboxes[4 * idx], sizes[idx], kept, nms_threshold)) {
             indices[detections] = idx;
+            kept.push_back(&bboxes[4 * idx], sizes[idx]);
             detections++;
         }
     }
-
-    detections = (post_nms_topn == -1 ? detections : (std::min)(post_nms_topn, detections));
 }
 
 bool MKLDNNExperimentalDetectronDetectionOutputNode::needShapeInfer() const {
@@ -303,40 +346,39 @@ void MKLDNNExperimentalDetectronDetectionOutputNode::execute(mkldnn::stream strm
                  max_delta_log_wh_,
                  1.0f);
 
-    // Apply NMS class-wise.
-    std::vector<int> buffer(rois_num, 0);
+    // Apply NMS class-wise, the classes are independent so processed in parallel.
+    std::vector<int> buffer(classes_num_ * rois_num, 0);
     std::vector<int> indices(classes_num_ * rois_num, 0);
     std::vector<int> detections_per_class(classes_num_, 0);
-    int total_detections_num = 0;
 
-    for (int class_idx = 1; class_idx < classes_num_; ++class_idx) {
+    parallel_for(classes_num_ - 1, [&](int i) {
+        const int class_idx = i + 1;
         nms_cf(&refined_scores[refined_score_idx({class_idx, 0})],
                &refined_boxes[refined_box_idx({class_idx, 0, 0})],
                &refined_boxes_areas[refined_score_idx({class_idx, 0})],
-               &buffer[0],
-               &indices[total_detections_num],
+               &buffer[refined_score_idx({class_idx, 0})],
+               &indices[refined_score_idx({class_idx, 0})],
                detections_per_class[class_idx],
                rois_num,
                -1,
                max_detections_per_class_,
                score_threshold_,
                nms_threshold_);
-        total_detections_num += detections_per_class[class_idx];
-    }
+    });
+    int total_detections_num = std::accumulate(detections_per_class.begin(), detections_per_class.end(), 0);
 
     // Leave only max_detections_per_image_ detections.
     // confidence, <class, index>
     std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+    conf_index_class_map.reserve(total_detections_num);
 
-    int indices_offset = 0;
     for (int c = 0; c < classes_num_; ++c) {
         int n = detections_per_class[c];
         for (int i = 0; i < n; ++i) {
-            int idx = indices[indices_offset + i];
+            int idx = indices[refined_score_idx({c, i})];
             float score = refined_scores[refined_score_idx({c, idx})];
             conf_index_class_map.push_back(std::make_pair(score, std::make_pair(c, idx)));
         }
-        indices_offset += n;
     }
 
     assert(max_detections_per_image_ > 0);
@@ -7,6 +7,7 @@
 #include "fake_quantize.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <extension_utils.h>
@@ -16,6 +17,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
 #include <common/primitive_hashing_utils.hpp>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace ov::intel_cpu;
@@ -162,6 +164,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // the compressed weights are processed by the own kernel, so the oneDNN descriptors are not created
+    if (isWeightsCompressed())
+        return;
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -218,6 +224,10 @@ void MKLDNNFullyConnectedNode::prepareParams() {
             IE_THROW() << "Input memory hasn't been allocated.";
     }
 
+    // the decompression kernels don't depend on the shapes, all the sizes are passed on the execution
+    if (isWeightsCompressed())
+        return;
+
     const NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
@@ -327,6 +337,11 @@ void MKLDNNFullyConnectedNode::prepareParams() {
 }
 
 void MKLDNNFullyConnectedNode::setDynamicBatchLim(int lim) {
+    if (isWeightsCompressed()) {
+        MKLDNNNode::setDynamicBatchLim(lim);
+        return;
+    }
+
     dynBatchLim = lim;
 
     auto setBatchPrimArgs = [this](int argType, const mkldnn::memory& oldMem) {
@@ -348,6 +363,11 @@ void MKLDNNFullyConnectedNode::setDynamicBatchLim(int lim) {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (isWeightsCompressed()) {
+        executeDecompressed();
+        return;
+    }
+
     if (prim) {
         // in cases parameter -> FullyConnected or dynamic shapes
         // we keep old pointer to data in primArgs on second iteration with same input shapes
@@ -375,6 +395,9 @@ void MKLDNNFullyConnectedNode::executeDynamicImpl(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    // the decompression kernels don't support post ops
+    if (isWeightsCompressed())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -520,6 +543,9 @@ void MKLDNNFullyConnectedNode::createDescriptorInternal(const mkldnn::memory::de
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (isWeightsCompressed())
+        return;
+
     MemoryDescPtr inpDesc;
     if (inputDesc[0]->isDefined()) {
         inpDesc = inputDesc[0];
@@ -541,6 +567,20 @@ void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (isWeightsCompressed()) {
+        impl_desc_type implType = impl_desc_type::ref;
+        if (canUseDecompressionJit()) {
+            implType = impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+        }
+
+        std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, Precision::FP32},
+                                                 {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+        if (withBiases)
+            inConfs.push_back({LayoutType::ncsp, Precision::FP32});
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}}, implType, true);
+        return;
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
         while (static_cast<bool>(itpd)) {
@@ -630,4 +670,141 @@ InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const
     return getMaxPrecision(inputPrecisions);
 }
 
+bool MKLDNNFullyConnectedNode::canUseDecompressionJit() const {
+    using impl::cpu::x64::mayiuse;
+    size_t elPerVec = 0;
+    if (mayiuse(impl::cpu::x64::avx512_common)) {
+        elPerVec = impl::cpu::x64::cpu_isa_traits<impl::cpu::x64::avx512_common>::vlen / sizeof(float);
+    } else if (mayiuse(impl::cpu::x64::avx2)) {
+        elPerVec = impl::cpu::x64::cpu_isa_traits<impl::cpu::x64::avx2>::vlen / sizeof(float);
+    } else {
+        return false;
+    }
+    // the kernel has no tails, every group of the reduction dim has to be the whole number of the vectors
+    const auto K = getInputShapeAtPort(WEIGHTS_ID).getStaticDims()[1];
+    return K % decompressionGroups == 0 && (K / decompressionGroups) % elPerVec == 0;
+}
+
+void MKLDNNFullyConnectedNode::createDecompressionKernels() {
+    const auto* selectedPD = getSelectedPrimitiveDescriptor();
+    if (selectedPD == nullptr)
+        IE_THROW() << errorPrefix << " has no selected primitive descriptor";
+    const auto implType = selectedPD->getImplementationType();
+    if (!one_of(implType, impl_desc_type::jit_avx512, impl_desc_type::jit_avx2) || !decompressionKernels.empty())
+        return;
+
+    if (implType == impl_desc_type::jit_avx512) {
+        decompressionNBlock = jitUniFcDecompressionKernel<impl::cpu::x64::avx512_common>::maxNBlock;
+        decompressionMBlock = jitUniFcDecompressionKernel<impl::cpu::x64::avx512_common>::maxMBlock;
+    } else {
+        decompressionNBlock = jitUniFcDecompressionKernel<impl::cpu::x64::avx2>::maxNBlock;
+        decompressionMBlock = jitUniFcDecompressionKernel<impl::cpu::x64::avx2>::maxMBlock;
+    }
+
+    jFcDecompressionConfParams jcp;
+    jcp.signedWeights = getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::I8;
+    decompressionKernels.resize(decompressionNBlock);
+    for (size_t nb = 0; nb < decompressionNBlock; nb++) {
+        for (size_t mb = 0; mb < decompressionMBlock; mb++) {
+            jcp.nBlock = nb + 1;
+            jcp.mBlock = mb + 1;
+            std::shared_ptr<jitFcDecompressionKernelBase> kernel;
+            if (implType == impl_desc_type::jit_avx512) {
+                kernel.reset(new jitUniFcDecompressionKernel<impl::cpu::x64::avx512_common>(jcp));
+            } else {
+                kernel.reset(new jitUniFcDecompressionKernel<impl::cpu::x64::avx2>(jcp));
+            }
+            kernel->create_ker();
+            decompressionKernels[nb].push_back(kernel);
+        }
+    }
+}
+
+void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (isWeightsCompressed())
+        createDecompressionKernels();
+    MKLDNNNode::createPrimitive();
+}
+
+void MKLDNNFullyConnectedNode::executeDecompressed() {
+    auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto* src = reinterpret_cast<const float*>(srcMemPtr->GetPtr());
+    const auto* weights = reinterpret_cast<const uint8_t*>(getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr()->GetPtr());
+    const auto* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* dst = reinterpret_cast<float*>(dstMemPtr->GetPtr());
+
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t N = weightsDims[0];
+    const size_t K = weightsDims[1];
+    // all the dims except the innermost one are flattened, the dynamic batch limits the outermost dim
+    size_t batch = srcDims[0];
+    if (dynBatchLim > 0)
+        batch = std::min<size_t>(batch, dynBatchLim);
+    const size_t M = std::accumulate(srcDims.begin() + 1, srcDims.end() - 1, batch, std::multiplies<size_t>());
+
+    if (decompressionKernels.empty()) {
+        executeDecompressedRef(src, weights, bias, dst, M, N, K);
+        return;
+    }
+
+    const size_t groupSize = K / decompressionGroups;
+    const size_t nBlocks = div_up(N, decompressionNBlock);
+    const size_t mBlocks = div_up(M, decompressionMBlock);
+    parallel_for2d(mBlocks, nBlocks, [&](size_t mb, size_t nb) {
+        const size_t m0 = mb * decompressionMBlock;
+        const size_t n0 = nb * decompressionNBlock;
+        const size_t mBlock = std::min(decompressionMBlock, M - m0);
+        const size_t nBlock = std::min(decompressionNBlock, N - n0);
+        const auto& kernel = decompressionKernels[nBlock - 1][mBlock - 1];
+        const size_t elPerVec = kernel->getElPerVec();
+
+        // the largest tile of the AVX512 kernel
+        float acc[4 * 3 * 16];
+        fcDecompressionJitExecArgs args;
+        args.src = src + m0 * K;
+        args.weights = weights + n0 * K;
+        args.scales = decompressionScales.data() + n0;
+        args.zpScales = decompressionZeroPointsScaled.data() + n0;
+        args.acc = acc;
+        args.srcStrideB = K * sizeof(float);
+        args.weightsStrideB = K;
+        args.scalesStrideB = N * sizeof(float);
+        args.groups = decompressionGroups;
+        args.groupSize = groupSize;
+        (*kernel)(&args);
+
+        for (size_t n = 0; n < nBlock; n++) {
+            for (size_t m = 0; m < mBlock; m++) {
+                const float* vec = acc + (n * mBlock + m) * elPerVec;
+                float sum = bias ? bias[n0 + n] : 0.f;
+                for (size_t i = 0; i < elPerVec; i++)
+                    sum += vec[i];
+                dst[(m0 + m) * N + n0 + n] = sum;
+            }
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::executeDecompressedRef(const float* src, const uint8_t* weights, const float* bias, float* dst,
+                                                      size_t M, size_t N, size_t K) {
+    const bool signedWeights = getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::I8;
+    const size_t groupSize = K / decompressionGroups;
+    parallel_for2d(M, N, [&](size_t m, size_t n) {
+        const float* srcRow = src + m * K;
+        const uint8_t* weightsRow = weights + n * K;
+        float sum = bias ? bias[n] : 0.f;
+        for (size_t g = 0; g < decompressionGroups; g++) {
+            const float scale = decompressionScales[g * N + n];
+            const float zpScale = decompressionZeroPointsScaled[g * N + n];
+            for (size_t k = g * groupSize; k < (g + 1) * groupSize; k++) {
+                const float w = signedWeights ? static_cast<float>(static_cast<int8_t>(weightsRow[k])) : static_cast<float>(weightsRow[k]);
+                sum += srcRow[k] * (w * scale - zpScale);
+            }
+        }
+        dst[m * N + n] = sum;
+    });
+}
+
 REG_MKLDNN_PRIM_FOR(MKLDNNFullyConnectedNode, FullyConnected);
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "kernels/fc_decompression_kernel.hpp"
 #include <memory>
 #include <string>
 #include <vector>
@@ -19,6 +20,7 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -55,6 +57,16 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    bool isWeightsCompressed() const {
+        return !decompressionScales.empty();
+    }
+
+    // The decompression of the u8/i8 weights fused from the Convert->[Subtract]->Multiply chain.
+    // The values are stored per [group][output channel], the zero points are premultiplied by the scales.
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionZeroPointsScaled;
+    size_t decompressionGroups = 1;
+
 private:
     void createDescriptorInternal(const mkldnn::memory::desc &inputDesc,
                                   const mkldnn::memory::desc &outputDesc);
@@ -67,8 +79,18 @@ private:
 
     void setPostOps(mkldnn::primitive_attr &attr, const VectorDims &dims, bool initWeights = false);
 
+    bool canUseDecompressionJit() const;
+    void createDecompressionKernels();
+    void executeDecompressed();
+    void executeDecompressedRef(const float* src, const uint8_t* weights, const float* bias, float* dst, size_t M, size_t N, size_t K);
+
     bool withBiases = false;
 
+    // The kernels for the tiles of all the sizes up to the maximal one, indexed by [nBlock - 1][mBlock - 1]
+    std::vector<std::vector<std::shared_ptr<jitFcDecompressionKernelBase>>> decompressionKernels;
+    size_t decompressionNBlock = 0;
+    size_t decompressionMBlock = 0;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
@@ -0,0 +1,159 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.hpp"
+#include <ie_common.h>
+#include <limits>
+#include "utils/general_utils.h"
+
+using namespace dnnl::impl::cpu;
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(embeddingBagJitExecArgs, field)
+
+template <x64::cpu_isa_t isa>
+jitUniEmbeddingBagKernel<isa>::jitUniEmbeddingBagKernel(const jEmbeddingBagConfParams& jcp) :
+        jitEmbeddingBagKernelBase(jcp), x64::jit_generator() {
+    elPerVec = vlen / sizeof(float);
+    tableTypeSize = jcp.tablePrecision.size();
+    rowStrideB = jcp.rowSize * tableTypeSize;
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::create_ker() {
+    if (!one_of(jcp.tablePrecision, Precision::FP32, Precision::BF16, Precision::U8, Precision::I8))
+        IE_THROW() << "Could not create EmbeddingBag kernel for the table precision " << jcp.tablePrecision.name();
+    if (rowStrideB > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()))
+        IE_THROW() << "Could not create EmbeddingBag kernel for the table row of " << jcp.rowSize << " elements";
+    auto code = x64::jit_generator::create_kernel();
+    if (code != dnnl::impl::status::success)
+        IE_THROW() << "Could not create EmbeddingBag kernel. Error code: " << std::to_string(code);
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::generate() {
+    this->preamble();
+
+    mov(regTable, ptr[regParams + GET_OFF(table)]);
+    mov(regIndices, ptr[regParams + GET_OFF(indices)]);
+    mov(regWeights, ptr[regParams + GET_OFF(weights)]);
+    mov(regScales, ptr[regParams + GET_OFF(scales)]);
+    mov(regZpScales, ptr[regParams + GET_OFF(zpScales)]);
+    mov(regDst, ptr[regParams + GET_OFF(dst)]);
+    mov(regWeightsStrideB, ptr[regParams + GET_OFF(weightsStrideB)]);
+
+    const uint64_t vecNum = jcp.rowSize / elPerVec;
+    for (uint64_t blockOffset = 0; blockOffset < vecNum; blockOffset += maxBlock) {
+        accumulateBlock(blockOffset, std::min(maxBlock, vecNum - blockOffset));
+    }
+
+    this->postamble();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::loadRowVector(const Vmm& vmmDst, const Xbyak::Address& addr) {
+    switch (jcp.tablePrecision) {
+        case Precision::FP32:
+            uni_vmovups(vmmDst, addr);
+            break;
+        case Precision::BF16:
+            vpmovzxwd(vmmDst, addr);
+            vpslld(vmmDst, vmmDst, 16);
+            break;
+        case Precision::U8:
+            vpmovzxbd(vmmDst, addr);
+            vcvtdq2ps(vmmDst, vmmDst);
+            break;
+        case Precision::I8:
+            vpmovsxbd(vmmDst, addr);
+            vcvtdq2ps(vmmDst, vmmDst);
+            break;
+        default:
+            IE_THROW() << "EmbeddingBag kernel does not support the table precision " << jcp.tablePrecision.name();
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::accumulateBlock(uint64_t blockOffset, uint64_t blockSize) {
+    const bool withDecompression = one_of(jcp.tablePrecision, Precision::U8, Precision::I8);
+    const uint64_t blockOffsetB = blockOffset * elPerVec * tableTypeSize;
+    const uint64_t blockSizeB = blockSize * elPerVec * tableTypeSize;
+
+    for (uint64_t v = 0; v < blockSize; v++) {
+        uni_vpxor(Vmm(v), Vmm(v), Vmm(v));
+    }
+    if (withDecompression)
+        uni_vpxor(vmmZpScaleSum, vmmZpScaleSum, vmmZpScaleSum);
+
+    mov(regIdxPtr, regIndices);
+    mov(regWeightsPtr, regWeights);
+    mov(regWorkAmount, ptr[regParams + GET_OFF(indicesNum)]);
+
+    Xbyak::Label lIdxLoop, lIdxEnd, lSkipPrefetch;
+    L(lIdxLoop);
+    {
+        cmp(regWorkAmount, 0);
+        je(lIdxEnd, T_NEAR);
+
+        movsxd(regRow, dword[regIdxPtr]);
+        if (jcp.withWeights)
+            vbroadcastss(vmmWeight, ptr[regWeightsPtr]);
+        if (withDecompression) {
+            // The weight is folded into the decompression: x * (scale * w) - zp * scale * w.
+            vbroadcastss(vmmScale, ptr[regScales + regRow * sizeof(float)]);
+            vbroadcastss(vmmZpScale, ptr[regZpScales + regRow * sizeof(float)]);
+            if (jcp.withWeights) {
+                vmulps(vmmScale, vmmScale, vmmWeight);
+                vmulps(vmmZpScale, vmmZpScale, vmmWeight);
+            }
+            vaddps(vmmZpScaleSum, vmmZpScaleSum, vmmZpScale);
+        }
+        imul(regRow, regRow, static_cast<int>(rowStrideB));
+        add(regRow, regTable);
+
+        // The rows are spread over the table, so the hardware prefetcher can't predict the next one.
+        cmp(regWorkAmount, static_cast<int>(prefetchDistance));
+        jbe(lSkipPrefetch, T_NEAR);
+        movsxd(regPrefetchRow, dword[regIdxPtr + prefetchDistance * sizeof(int)]);
+        imul(regPrefetchRow, regPrefetchRow, static_cast<int>(rowStrideB));
+        add(regPrefetchRow, regTable);
+        for (uint64_t lineB = 0; lineB < blockSizeB; lineB += cacheLineB) {
+            prefetcht0(ptr[regPrefetchRow + blockOffsetB + lineB]);
+        }
+        L(lSkipPrefetch);
+
+        for (uint64_t v = 0; v < blockSize; v++) {
+            loadRowVector(vmmSrc, ptr[regRow + blockOffsetB + v * elPerVec * tableTypeSize]);
+            if (withDecompression) {
+                vfmadd231ps(Vmm(v), vmmSrc, vmmScale);
+            } else if (jcp.withWeights) {
+                vfmadd231ps(Vmm(v), vmmSrc, vmmWeight);
+            } else {
+                vaddps(Vmm(v), Vmm(v), vmmSrc);
+            }
+        }
+
+        add(regIdxPtr, sizeof(int));
+        add(regWeightsPtr, regWeightsStrideB);
+        dec(regWorkAmount);
+        jmp(lIdxLoop, T_NEAR);
+    }
+    L(lIdxEnd);
+
+    for (uint64_t v = 0; v < blockSize; v++) {
+        if (withDecompression)
+            vsubps(Vmm(v), Vmm(v), vmmZpScaleSum);
+        uni_vmovups(ptr[regDst + (blockOffset + v) * vlen], Vmm(v));
+    }
+}
+
+template struct jitUniEmbeddingBagKernel<x64::avx2>;
+template struct jitUniEmbeddingBagKernel<x64::avx512_common>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,122 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Gather-accumulate kernel of the EmbeddingBag nodes.
+// The kernel sums the table rows selected by the indices of one bag into the f32 output row:
+//     dst[d] = sum_i (table[idx_i][d] * scale[idx_i] - zp[idx_i] * scale[idx_i]) * weight_i
+// where the scales and zero points are the row-wise decompression of the u8/i8 table and the weights are the per sample ones.
+// The row is processed by the blocks of the vectors which fit the accumulators, for every block the kernel walks
+// through the indices of the bag and prefetches the rows of the indices which are prefetchDistance ahead.
+// The tail of the row which is shorter than the vector is left to the caller.
+//
+//             SUPPORTED CASES
+//-------------------------------------------
+//  Table           |  AVX512   |   AVX2    |
+//  f32, bf16       |     X     |     X     |
+//  u8, i8 row-wise |     X     |     X     |
+//-------------------------------------------
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <mkldnn_types.h>
+#include <ie_precision.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jEmbeddingBagConfParams {
+    // The u8/i8 tables are always decompressed.
+    InferenceEngine::Precision tablePrecision = InferenceEngine::Precision::FP32;
+    bool withWeights = false;
+    uint64_t rowSize = 0lu;
+};
+
+struct embeddingBagJitExecArgs {
+    const uint8_t* table;
+    const int* indices;
+    const float* weights;
+    const float* scales;
+    const float* zpScales;
+    float* dst;
+    uint64_t indicesNum;
+    // Suffix B means "In Bytes".
+    uint64_t weightsStrideB;
+};
+
+struct jitEmbeddingBagKernelBase {
+    void (*ker_)(const embeddingBagJitExecArgs *);
+    void operator()(const embeddingBagJitExecArgs *args) {
+        assert(ker_);
+        ker_(args);
+    }
+    explicit jitEmbeddingBagKernelBase(const jEmbeddingBagConfParams& jcp) : ker_(nullptr), jcp(jcp) {}
+    virtual ~jitEmbeddingBagKernelBase() {}
+
+    virtual void create_ker() = 0;
+    uint64_t getElPerVec() const {
+        return elPerVec;
+    }
+    // The number of the row elements processed by the kernel, the rest is the tail.
+    uint64_t getProcessedRowSize() const {
+        return jcp.rowSize / elPerVec * elPerVec;
+    }
+    const jEmbeddingBagConfParams& getJcp() const {
+        return jcp;
+    }
+
+protected:
+    jEmbeddingBagConfParams jcp;
+    uint64_t elPerVec = 0lu;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jitUniEmbeddingBagKernel : public jitEmbeddingBagKernelBase, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jitUniEmbeddingBagKernel)
+
+    explicit jitUniEmbeddingBagKernel(const jEmbeddingBagConfParams& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+    // The number of the indices between the accumulated row and the prefetched one.
+    static constexpr uint64_t prefetchDistance = 4lu;
+
+protected:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    static const uint32_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    // The accumulators of the block, the rest of the registers are used for the source, the weight and the decompression.
+    static constexpr uint64_t maxBlock = isa == dnnl::impl::cpu::x64::avx2 ? 8lu : 16lu;
+    static constexpr uint64_t cacheLineB = 64lu;
+
+    const Xbyak::Reg64& regTable = r8;
+    const Xbyak::Reg64& regIndices = r9;
+    const Xbyak::Reg64& regWeights = r10;
+    const Xbyak::Reg64& regScales = r11;
+    const Xbyak::Reg64& regZpScales = r12;
+    const Xbyak::Reg64& regDst = r13;
+    const Xbyak::Reg64& regWeightsStrideB = r14;
+    const Xbyak::Reg64& regWorkAmount = r15;
+    const Xbyak::Reg64& regRow = rax;
+    const Xbyak::Reg64& regPrefetchRow = rbx;
+    const Xbyak::Reg64& regIdxPtr = rdx;
+    const Xbyak::Reg64& regWeightsPtr = rsi;
+
+    const Xbyak::Reg64& regParams = dnnl::impl::cpu::x64::abi_param1;
+
+    const Vmm vmmSrc = Vmm(maxBlock);
+    const Vmm vmmWeight = Vmm(maxBlock + 1);
+    const Vmm vmmScale = Vmm(maxBlock + 2);
+    const Vmm vmmZpScale = Vmm(maxBlock + 3);
+    const Vmm vmmZpScaleSum = Vmm(maxBlock + 4);
+
+    uint64_t tableTypeSize = 0lu;
+    uint64_t rowStrideB = 0lu;
+
+    void accumulateBlock(uint64_t blockOffset, uint64_t blockSize);
+    void loadRowVector(const Vmm& vmmDst, const Xbyak::Address& addr);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,137 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_decompression_kernel.hpp"
+#include <ie_common.h>
+
+using namespace dnnl::impl::cpu;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(fcDecompressionJitExecArgs, field)
+
+template <x64::cpu_isa_t isa>
+jitUniFcDecompressionKernel<isa>::jitUniFcDecompressionKernel(const jFcDecompressionConfParams& jcp) :
+        jitFcDecompressionKernelBase(jcp), x64::jit_generator() {
+    elPerVec = vlen / sizeof(float);
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniFcDecompressionKernel<isa>::create_ker() {
+    if (jcp.nBlock == 0 || jcp.nBlock > maxNBlock || jcp.mBlock == 0 || jcp.mBlock > maxMBlock)
+        IE_THROW() << "Could not create FullyConnected decompression kernel for the tile " << jcp.nBlock << "x" << jcp.mBlock;
+    auto code = x64::jit_generator::create_kernel();
+    if (code != dnnl::impl::status::success)
+        IE_THROW() << "Could not create FullyConnected decompression kernel. Error code: " << std::to_string(code);
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <x64::cpu_isa_t isa>
+Xbyak::Address jitUniFcDecompressionKernel<isa>::weightsPtr(uint64_t n) {
+    switch (n) {
+        case 0: return ptr[regWeights];
+        case 1: return ptr[regWeights + regWeightsStrideB];
+        case 2: return ptr[regWeights + regWeightsStrideB * 2];
+        default: return ptr[regWeights + regWeightsStride3B];
+    }
+}
+
+template <x64::cpu_isa_t isa>
+Xbyak::Address jitUniFcDecompressionKernel<isa>::srcPtr(uint64_t m) {
+    switch (m) {
+        case 0: return ptr[regSrc];
+        case 1: return ptr[regSrc + regSrcStrideB];
+        default: return ptr[regSrc + regSrcStrideB * 2];
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniFcDecompressionKernel<isa>::generate() {
+    this->preamble();
+
+    mov(regSrc, ptr[regParams + GET_OFF(src)]);
+    mov(regWeights, ptr[regParams + GET_OFF(weights)]);
+    mov(regScales, ptr[regParams + GET_OFF(scales)]);
+    mov(regZpScales, ptr[regParams + GET_OFF(zpScales)]);
+    mov(regAcc, ptr[regParams + GET_OFF(acc)]);
+    mov(regSrcStrideB, ptr[regParams + GET_OFF(srcStrideB)]);
+    mov(regWeightsStrideB, ptr[regParams + GET_OFF(weightsStrideB)]);
+    mov(regScalesStrideB, ptr[regParams + GET_OFF(scalesStrideB)]);
+    mov(regGroups, ptr[regParams + GET_OFF(groups)]);
+    mov(regGroupSize, ptr[regParams + GET_OFF(groupSize)]);
+    if (jcp.nBlock > 3) {
+        lea(regWeightsStride3B, ptr[regWeightsStrideB + regWeightsStrideB * 2]);
+    }
+
+    for (uint64_t n = 0; n < jcp.nBlock; n++) {
+        for (uint64_t m = 0; m < jcp.mBlock; m++) {
+            uni_vpxor(vmmAcc(n, m), vmmAcc(n, m), vmmAcc(n, m));
+        }
+    }
+
+    Xbyak::Label lGroupLoop, lGroupEnd, lVecLoop, lVecEnd;
+    L(lGroupLoop);
+    {
+        cmp(regGroups, 0);
+        je(lGroupEnd, T_NEAR);
+
+        // The decompression parameters are the same for the whole group of the channel.
+        for (uint64_t n = 0; n < jcp.nBlock; n++) {
+            vbroadcastss(vmmScale(n), ptr[regScales + n * sizeof(float)]);
+            vbroadcastss(vmmZpScale(n), ptr[regZpScales + n * sizeof(float)]);
+        }
+
+        mov(regWorkAmount, regGroupSize);
+        L(lVecLoop);
+        {
+            cmp(regWorkAmount, static_cast<int>(elPerVec));
+            jl(lVecEnd, T_NEAR);
+
+            for (uint64_t n = 0; n < jcp.nBlock; n++) {
+                const auto vWeights = vmmWeights(n);
+                if (jcp.signedWeights) {
+                    vpmovsxbd(vWeights, weightsPtr(n));
+                } else {
+                    vpmovzxbd(vWeights, weightsPtr(n));
+                }
+                vcvtdq2ps(vWeights, vWeights);
+                // w * scale - zp * scale
+                vfmsub213ps(vWeights, vmmScale(n), vmmZpScale(n));
+            }
+            for (uint64_t m = 0; m < jcp.mBlock; m++) {
+                uni_vmovups(vmmSrc(), srcPtr(m));
+                for (uint64_t n = 0; n < jcp.nBlock; n++) {
+                    vfmadd231ps(vmmAcc(n, m), vmmWeights(n), vmmSrc());
+                }
+            }
+
+            add(regWeights, static_cast<int>(elPerVec));
+            add(regSrc, vlen);
+            sub(regWorkAmount, static_cast<int>(elPerVec));
+            jmp(lVecLoop, T_NEAR);
+        }
+        L(lVecEnd);
+
+        add(regScales, regScalesStrideB);
+        add(regZpScales, regScalesStrideB);
+        dec(regGroups);
+        jmp(lGroupLoop, T_NEAR);
+    }
+    L(lGroupEnd);
+
+    for (uint64_t n = 0; n < jcp.nBlock; n++) {
+        for (uint64_t m = 0; m < jcp.mBlock; m++) {
+            uni_vmovups(ptr[regAcc + (n * jcp.mBlock + m) * vlen], vmmAcc(n, m));
+        }
+    }
+
+    this->postamble();
+}
+
+template struct jitUniFcDecompressionKernel<x64::avx2>;
+template struct jitUniFcDecompressionKernel<x64::avx512_common>;
+
+}   // namespace intel_cpu
+}   // namespace ov
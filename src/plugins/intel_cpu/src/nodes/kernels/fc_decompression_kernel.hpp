@@ -0,0 +1,118 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// FullyConnected kernel for the compressed u8/i8 weights.
+// The kernel computes the tile of nBlock output channels by mBlock rows of the source. The weights are kept in
+// the original [N, K] layout, each vector of them is converted to f32 and dequantized in the registers:
+//     w_f32 = w * scale[n][g] - zp[n][g] * scale[n][g]
+// where g is the group of the K dimension. The per channel decompression is the case of the single group.
+// The accumulators are stored as the vectors, the horizontal sums are left to the caller.
+//
+//                 SUPPORTED CASES
+//-------------------------------------------------
+//  Weights | Group size |    AVX512   |    AVX2   |
+//  u8, i8  | % vlen = 0 | 4 x 3 tile  | 2 x 3 tile|
+//-------------------------------------------------
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <mkldnn_types.h>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jFcDecompressionConfParams {
+    bool signedWeights = false;
+    uint64_t nBlock = 1lu;
+    uint64_t mBlock = 1lu;
+};
+
+struct fcDecompressionJitExecArgs {
+    const float* src;
+    const uint8_t* weights;
+    const float* scales;
+    const float* zpScales;
+    float* acc;
+    // Suffix B means "In Bytes".
+    uint64_t srcStrideB;
+    uint64_t weightsStrideB;
+    uint64_t scalesStrideB;
+    uint64_t groups;
+    uint64_t groupSize;
+};
+
+struct jitFcDecompressionKernelBase {
+    void (*ker_)(const fcDecompressionJitExecArgs *);
+    void operator()(const fcDecompressionJitExecArgs *args) {
+        assert(ker_);
+        ker_(args);
+    }
+    explicit jitFcDecompressionKernelBase(const jFcDecompressionConfParams& jcp) : ker_(nullptr), jcp(jcp) {}
+    virtual ~jitFcDecompressionKernelBase() {}
+
+    virtual void create_ker() = 0;
+    uint64_t getElPerVec() const {
+        return elPerVec;
+    }
+
+protected:
+    jFcDecompressionConfParams jcp;
+    uint64_t elPerVec = 0lu;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jitUniFcDecompressionKernel : public jitFcDecompressionKernelBase, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jitUniFcDecompressionKernel)
+
+    explicit jitUniFcDecompressionKernel(const jFcDecompressionConfParams& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+    // The maximal tile which fits the vector registers: accumulators, scales and zero points, weights and source.
+    static constexpr uint64_t maxNBlock = isa == dnnl::impl::cpu::x64::avx2 ? 2lu : 4lu;
+    static constexpr uint64_t maxMBlock = 3lu;
+
+protected:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    static const uint32_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+
+    const Xbyak::Reg64& regSrc = r8;
+    const Xbyak::Reg64& regWeights = r9;
+    const Xbyak::Reg64& regScales = r10;
+    const Xbyak::Reg64& regZpScales = r11;
+    const Xbyak::Reg64& regSrcStrideB = r12;
+    const Xbyak::Reg64& regWeightsStrideB = r13;
+    const Xbyak::Reg64& regWeightsStride3B = r14;
+    const Xbyak::Reg64& regGroups = r15;
+    const Xbyak::Reg64& regGroupSize = rbx;
+    const Xbyak::Reg64& regScalesStrideB = rdx;
+    const Xbyak::Reg64& regWorkAmount = rax;
+    const Xbyak::Reg64& regAcc = rsi;
+
+    const Xbyak::Reg64& regParams = dnnl::impl::cpu::x64::abi_param1;
+
+    Vmm vmmAcc(uint64_t n, uint64_t m) const {
+        return Vmm(n * jcp.mBlock + m);
+    }
+    Vmm vmmScale(uint64_t n) const {
+        return Vmm(jcp.nBlock * jcp.mBlock + n);
+    }
+    Vmm vmmZpScale(uint64_t n) const {
+        return Vmm(jcp.nBlock * jcp.mBlock + jcp.nBlock + n);
+    }
+    Vmm vmmWeights(uint64_t n) const {
+        return Vmm(jcp.nBlock * jcp.mBlock + 2 * jcp.nBlock + n);
+    }
+    Vmm vmmSrc() const {
+        return Vmm(jcp.nBlock * jcp.mBlock + 3 * jcp.nBlock);
+    }
+
+    Xbyak::Address weightsPtr(uint64_t n);
+    Xbyak::Address srcPtr(uint64_t m);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
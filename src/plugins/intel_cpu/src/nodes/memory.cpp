@@ -75,12 +75,58 @@ void MKLDNNMemoryOutputNode::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+void MKLDNNMemoryOutputNode::createPrimitive() {
+    shareInputMemory = canShareInputMemory();
+}
+
+/**
+ * The producer of the new state value can write it directly to the buffer of the ReadValue node if its output memory
+ * is not used by anyone else. The same restrictions as for the graph outputs sharing the user memory are applied.
+ */
+bool MKLDNNMemoryOutputNode::canShareInputMemory() const {
+    auto inputMemoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(inputNode);
+    if (!inputMemoryNode)
+        return false;
+
+    auto parentEdge = getParentEdgeAt(0);
+    if (!parentEdge->getMemory().getDesc().isCompatible(inputMemoryNode->getChildEdgeAt(0)->getMemory().getDesc()))
+        return false;
+
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    auto parent = parentEdge->getParent();
+    MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace() ||
+            one_of(parent->getType(), Input, MemoryInput)) {
+            return false;
+        }
+
+        for (auto& edge : parent->getParentEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
 void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
-    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& srcMemory = getParentEdgeAt(0)->getMemoryPtr();
 
     auto inputMemoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(inputNode);
     IE_ASSERT(inputMemoryNode != nullptr);
-    inputMemoryNode->storeState(srcMemory);
+    inputMemoryNode->storeState(*srcMemory);
+
+    // the next value is produced directly to the spare buffer of the ReadValue node
+    if (shareInputMemory) {
+        srcMemory->setDataHandle(inputMemoryNode->getNextStore()->GetData());
+    }
 }
 
 bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -103,7 +149,7 @@ bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngr
 }
 
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(op, eng, cache), MKLDNNMemoryNode(op), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(op, eng, cache), MKLDNNMemoryNode(op), dataStore(new MKLDNNMemory{eng}), nextStore(new MKLDNNMemory{eng}) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -117,10 +163,43 @@ void MKLDNNMemoryInputNode::createPrimitive() {
     MKLDNNInputNode::createPrimitive();
 
     dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    nextStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
 
     // default memory state is zero filled
-    if (dataStore->getDesc().hasDefinedMaxSize())
+    if (dataStore->getDesc().hasDefinedMaxSize()) {
         dataStore->FillZero();
+        nextStore->FillZero();
+    }
+
+    shareOutputMemory = canShareOutputMemory();
+}
+
+/**
+ * The consumers can read the state directly from the node buffer if none of them modifies it in-place
+ * or uses its memory with offsets. The same restrictions as for the graph inputs sharing the user memory are applied.
+ */
+bool MKLDNNMemoryInputNode::canShareOutputMemory() const {
+    for (auto& edge : getChildEdges()) {
+        auto childEdge = edge.lock();
+        if (!childEdge)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
+
+        auto& child = childEdge->getChild();
+        if (child->isConstant() || child->isInPlace() ||
+            one_of(child->getType(), Concatenation, Split, Output, MemoryOutput)) {
+            return false;
+        }
+
+        for (auto& grandChildEdge : child->getChildEdges()) {
+            auto e = grandChildEdge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == childEdge->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
 }
 
 /**
@@ -146,21 +225,42 @@ MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
 }
 
 MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
-    return dataStore;
+    return hasNextState ? nextStore : dataStore;
+}
+
+MKLDNNMemoryPtr MKLDNNMemoryInputNode::getNextStore() const {
+    // if the next state is already stored, the current buffer becomes the spare one after the swap
+    return hasNextState ? dataStore : nextStore;
 }
 
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    // the consumers of the current state may be executed after the Assign node, so the new state
+    // is stored to the spare buffer (no copy if it is produced there directly)
+    auto& store = *getNextStore();
+    if (store.GetData() != new_state.GetData())
+        simple_copy(store, new_state);
+    if (!hasNextState) {
+        hasNextState = true;
+    } else {
+        // the Assign is executed again before the ReadValue, so the latest value is in the current buffer
+        std::swap(dataStore, nextStore);
+    }
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
-    // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    if (hasNextState) {
+        std::swap(dataStore, nextStore);
+        hasNextState = false;
+    }
+
+    auto& dstMemory = getChildEdgeAt(0)->getMemoryPtr();
+    if (shareOutputMemory) {
+        // all the child edges share the same memory manager
+        if (dstMemory->GetData() != dataStore->GetData())
+            dstMemory->setDataHandle(dataStore->GetData());
+    } else {
+        simple_copy(*dstMemory, *dataStore);
+    }
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
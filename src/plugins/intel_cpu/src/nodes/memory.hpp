@@ -11,10 +11,13 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <mutex>
 
 namespace ov {
 namespace intel_cpu {
 
+class MKLDNNVariableState;
+
 class MKLDNNMemoryNode {
     std::string _id;
  public:
@@ -63,7 +66,7 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override {
         return getType() == MemoryOutput;
@@ -74,10 +77,13 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     }
 
  private:
+    bool canShareInputMemory() const;
+
     /**
      * @brief keeps reference to input sibling node
      */
     MKLDNNNode* inputNode = nullptr;
+    bool shareInputMemory = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -99,10 +105,35 @@ public:
 
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
+    // the latest value of the state
     MKLDNNMemoryPtr getStore();
- private:
+    // the buffer the next value of the state can be written to directly by the Assign node
+    MKLDNNMemoryPtr getNextStore() const;
+
+    std::mutex& getStateMutex() {
+        return stateMutex;
+    }
+    std::shared_ptr<MKLDNNVariableState> getStateOwner() const {
+        return stateOwner.lock();
+    }
+    void setStateOwner(const std::shared_ptr<MKLDNNVariableState>& owner) {
+        stateOwner = owner;
+    }
+
+private:
+    bool canShareOutputMemory() const;
+
+    // Ping-pong buffers: the ReadValue output is dataStore, the Assign writes to nextStore,
+    // so the buffers are swapped on the next execution instead of copying the state
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr nextStore;
+    bool hasNextState = false;
+    bool shareOutputMemory = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
+
+    // the variable state of the infer request which value is kept in the node memory
+    std::mutex stateMutex;
+    std::weak_ptr<MKLDNNVariableState> stateOwner;
 };
 
 }   // namespace intel_cpu
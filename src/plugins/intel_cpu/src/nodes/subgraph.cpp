@@ -31,24 +31,31 @@ using namespace mkldnn::impl::cpu;
 using namespace mkldnn::impl::cpu::x64;
 using namespace Xbyak;
 
+// Create a deep local copy of the snippet to perform canonicalization & code generation
+// Todo: Probably better to implement a proper copy constructor
+static std::shared_ptr<ngraph::snippets::op::Subgraph> copySnippet(const std::shared_ptr<ngraph::snippets::op::Subgraph>& original,
+                                                                   dnnl::impl::cpu::x64::cpu_isa_t isa) {
+    ngraph::OutputVector subgraph_node_inputs;
+    for (const auto &input : original->input_values()) {
+        auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+        subgraph_node_inputs.push_back(new_input);
+    }
+    auto new_body = ov::clone_model(*original->get_body().get());
+    auto copy = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(original, copy);
+    copy->set_friendly_name(original->get_friendly_name());
+    copy->set_generator(std::make_shared<CPUGenerator>(isa));
+    return copy;
+}
+
 MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(op, eng, cache) {
     host_isa = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_common) ?
         dnnl::impl::cpu::x64::avx512_common : dnnl::impl::cpu::x64::avx2;
 
-    // Create a deep local copy of the input snippet to perform canonicalization & code generation
-    // Todo: Probably better to implement a proper copy constructor
     if (const auto tmp_snippet =  ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op)) {
-        ngraph::OutputVector subgraph_node_inputs;
-        for (const auto &input : tmp_snippet->input_values()) {
-            auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
-            subgraph_node_inputs.push_back(new_input);
-        }
-        auto new_body = ov::clone_model(*tmp_snippet->get_body().get());
-        snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-        ngraph::copy_runtime_info(tmp_snippet, snippet);
-        snippet->set_friendly_name(tmp_snippet->get_friendly_name());
-        snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+        snippet = copySnippet(tmp_snippet, host_isa);
+        hasReductions = snippet->has_reductions();
     } else {
         IE_THROW(NotImplemented) << "Node is not an instance of snippets::op::Subgraph";
     }
@@ -58,7 +65,19 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    const Precision supportedPrecision = Precision::FP32;
+    // The snippet is executed in fp32, while the low precision data is converted by the loads and stores in registers
+    auto getSupportedPrecision = [](Precision prc) {
+        const bool supported = one_of(prc, Precision::FP32, Precision::I8, Precision::U8) ||
+                               (prc == Precision::BF16 && mayiuse(avx512_core));
+        return supported ? prc : Precision::FP32;
+    };
+    std::vector<Precision> inputPrecisions;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        inputPrecisions.push_back(getSupportedPrecision(getOriginalInputPrecisionAtPort(i)));
+    std::vector<Precision> outputPrecisions;
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        outputPrecisions.push_back(getSupportedPrecision(getOriginalOutputPrecisionAtPort(i)));
+    const bool isInPlaceApplicable = canBeInPlace() && inputPrecisions[0] == outputPrecisions[0];
 
     bool dimRanksAreEqual = true;
     for (size_t i = 0; dimRanksAreEqual && i < inputShapes.size(); i++) {
@@ -69,11 +88,12 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual;
+    // The reductions are performed along the innermost dimension of the planar layout only
+    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual && !hasReductions;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
-    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual;
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !hasReductions;
     enum LayoutType {
         Planar,
         ChannelsFirst,
@@ -125,12 +145,12 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
         for (size_t i = 0; i < inputShapes.size(); i++) {
             BlockedMemoryDesc::CmpMask inputMask = BLOCKED_DESC_SKIP_OFFSET_MASK;
             PortConfig portConfig;
-            portConfig.inPlace((!i && canBeInPlace()) ? 0 : -1);
+            portConfig.inPlace((!i && isInPlaceApplicable) ? 0 : -1);
             portConfig.constant(false);
             if (inputShapes[i].getDims()[0] == 1) {
                 inputMask.reset(0); // accepts any stride on batch axis
             }
-            portConfig.setMemDesc(createMemoryDesc(inputShapes[i], supportedPrecision, offset), inputMask);
+            portConfig.setMemDesc(createMemoryDesc(inputShapes[i], inputPrecisions[i], offset), inputMask);
             config.inConfs[i] = portConfig;
         }
         config.outConfs.resize(outputShapes.size());
@@ -142,7 +162,7 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
             if (outputShapes[i].getDims()[0] == 1) {
                 outputMask.reset(0); // accepts any stride on batch axis
             }
-            portConfig.setMemDesc(createMemoryDesc(outputShapes[i], supportedPrecision, offset), outputMask);
+            portConfig.setMemDesc(createMemoryDesc(outputShapes[i], outputPrecisions[i], offset), outputMask);
             config.outConfs[i] = portConfig;
         }
 
@@ -167,6 +187,11 @@ void MKLDNNSnippetNode::selectOptimalPrimitiveDescriptor() {
 }
 
 void MKLDNNSnippetNode::createPrimitive() {
+    if (isDynamicNode()) {
+        MKLDNNNode::createPrimitive();
+        return;
+    }
+
     // schedule definition part
     // it defines offsets, strides and sizes for snippet kernel scheduling
     define_schedule();
@@ -179,11 +204,31 @@ void MKLDNNSnippetNode::createPrimitive() {
     generate();
 }
 
+void MKLDNNSnippetNode::prepareParams() {
+    define_schedule();
+
+    // The code is regenerated only if the broadcasting pattern is changed, while the changed dims
+    // (including the tile rank and collapsed dims) are passed to the kernel in the call args
+    const auto pattern = getBroadcastPattern();
+    auto it = shapeAgnosticKernels.find(pattern);
+    if (it == shapeAgnosticKernels.end())
+        it = shapeAgnosticKernels.emplace(pattern, generate_shape_agnostic()).first;
+    schedule = it->second.schedule;
+
+    runtimeArgs = jit_snippets_call_args();
+    const size_t harness_num_dims = std::min<size_t>(exec_domain.size() - 1, SNIPPETS_MAX_HARNESS_DIMS);
+    init_schedule_args(runtimeArgs.scheduler_dims, runtimeArgs.scheduler_offsets, runtimeArgs.data_offsets, harness_num_dims);
+}
+
+void MKLDNNSnippetNode::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
 void MKLDNNSnippetNode::execute(dnnl::stream strm) {
     if (schedule.ptr == nullptr || !canUseOptimizedImpl) {
         IE_THROW() << "MKLDNNSnippetNode can't use Optimized implementation and can't fallback to reference";
     }
-    jit_snippets_call_args call_args;
+    jit_snippets_call_args call_args = runtimeArgs;
     for (size_t i = 0; i < srcMemPtrs.size(); i++)
         call_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(srcMemPtrs[i]->GetData()) + start_offset_in[i];
 
@@ -202,7 +247,8 @@ bool MKLDNNSnippetNode::created() const {
 }
 
 bool MKLDNNSnippetNode::canBeInPlace() const {
-    if (getParentEdgesAtPort(0)[0]->getParent()->getType() == Input) {
+    // the reductions read the same row several times, so it mustn't be overwritten by the outputs
+    if (isDynamicNode() || hasReductions || getParentEdgesAtPort(0)[0]->getParent()->getType() == Input) {
         return false;
     }
 
@@ -262,14 +308,21 @@ void MKLDNNSnippetNode::define_schedule() {
         std::copy(dims.begin(), dims.end(), &result[tensorRank - dims.size()]);
         return result;
     };
-    ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes;
+    input_blocked_shapes.clear();
     for (size_t i = 0; i < inputShapes.size(); i++)
         input_blocked_shapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
 
-    ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes;
+    output_blocked_shapes.clear();
     for (size_t i = 0; i < outputShapes.size(); i++)
         output_blocked_shapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
     exec_domain = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
+    // the schedule is redefined on each shapes change in case of dynamic shapes
+    tileRank = 1;
+    dims_in.clear();
+    dims_out.clear();
+    sch_offsets_in.clear();
+    sch_offsets_out.clear();
+    sch_dims.clear();
     // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
     tensorRank = std::max(static_cast<size_t>(rank6D), exec_domain.size());
     // Canonicalization broadcasts inputs and outputs to max input rank, which can be smaller than tensorRank
@@ -285,8 +338,10 @@ void MKLDNNSnippetNode::define_schedule() {
     }
 
     const auto config = getSelectedPrimitiveDescriptor()->getConfig();
-    const auto dataSize = config.inConfs[0].getMemDesc()->getPrecision().size();
-    auto initOffsets = [this, config, dataSize]() {
+    // the ports may have different precisions, so the offsets are in bytes of the corresponding port
+    auto inDataSize = [&config](size_t i) -> int64_t { return config.inConfs[i].getMemDesc()->getPrecision().size(); };
+    auto outDataSize = [&config](size_t i) -> int64_t { return config.outConfs[i].getMemDesc()->getPrecision().size(); };
+    auto initOffsets = [this, config, inDataSize, outDataSize]() {
         // find max rank input among all outputs
         const size_t inputNum = getParentEdges().size();
         offsets_in.resize(inputNum);
@@ -294,7 +349,7 @@ void MKLDNNSnippetNode::define_schedule() {
             offsets_in[i].resize(tensorRank, 1);
             offset_calculation(offsets_in[i], dims_in[i], exec_domain);
             for (size_t j = 0; j < tensorRank; j++) {
-                offsets_in[i][j] *= dataSize;
+                offsets_in[i][j] *= inDataSize(i);
             }
         }
 
@@ -303,7 +358,7 @@ void MKLDNNSnippetNode::define_schedule() {
         for (size_t i = 0; i < inputNum; i++) {
             const auto memPtr = getParentEdgeAt(i)->getMemoryPtr();
             srcMemPtrs[i] = memPtr;
-            start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize;
+            start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * inDataSize(i);
         }
 
         const size_t outputNum = config.outConfs.size();
@@ -312,7 +367,7 @@ void MKLDNNSnippetNode::define_schedule() {
             offsets_out[i].resize(tensorRank, 1);
             offset_calculation(offsets_out[i], dims_out[i], exec_domain);
             for (size_t j = 0; j < tensorRank; j++) {
-                offsets_out[i][j] *= dataSize;
+                offsets_out[i][j] *= outDataSize(i);
             }
         }
 
@@ -321,7 +376,7 @@ void MKLDNNSnippetNode::define_schedule() {
         for (size_t i = 0; i < outputNum; i++) {
             const auto memPtr = getChildEdgeAt(i)->getMemoryPtr();
             dstMemPtrs[i] = memPtr;
-            start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize;
+            start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * outDataSize(i);
         }
     };
 
@@ -334,7 +389,8 @@ void MKLDNNSnippetNode::define_schedule() {
             if (static_cast<int>(exec_domain.size()) - collapsedDims - 2 < 0)
                 break;
 
-            bool canCollapse = true;
+            // the rows of the reductions mustn't be merged
+            bool canCollapse = !hasReductions;
             for (size_t i = 0; i < dims_in.size(); i++) {
                 if ((dims_in[i][dims_in[i].size() - 2] != 1 && dims_in[i][dims_in[i].size() - 1] == 1) ||
                     (dims_in[i][dims_in[i].size() - 2] == 1 && dims_in[i][dims_in[i].size() - 1] != 1)) {
@@ -371,7 +427,7 @@ void MKLDNNSnippetNode::define_schedule() {
         return collapsedDims;
     };
 
-    auto initSchedulingInfo = [this, dataSize]() -> void {
+    auto initSchedulingInfo = [this, inDataSize, outDataSize]() -> void {
         // initialize scheduling information
         sch_offsets_in.resize(offsets_in.size(), 0);
         sch_offsets_out.resize(offsets_out.size(), 0);
@@ -386,6 +442,7 @@ void MKLDNNSnippetNode::define_schedule() {
             // update offsets for tile 2D because loaders have ptr shifts in some cases and stores have always ptrs shifts
             for (size_t i = 0; i < offsets_in.size(); i++) {
                 int64_t offset = offsets_in[i][tensorRank - 2];
+                const int64_t dataSize = inDataSize(i);
                 if ((offset > dataSize) || (offset == 0 && dims_in[i].back() != 1)) {
                     sch_offsets_in[i] = offset - exec_domain.back() * dataSize;
                 } else if (offset == dataSize) {
@@ -395,7 +452,9 @@ void MKLDNNSnippetNode::define_schedule() {
 
             for (size_t i = 0; i < offsets_out.size(); i++) {
                 int64_t offset = offsets_out[i][tensorRank - 2];
-                sch_offsets_out[i] = offset - exec_domain.back() * dataSize;
+                // the reduced values are stored once per row
+                const int64_t rowSize = hasReductions && dims_out[i].back() == 1 ? 1 : exec_domain.back();
+                sch_offsets_out[i] = offset - rowSize * outDataSize(i);
             }
         }
     };
@@ -413,25 +472,58 @@ void MKLDNNSnippetNode::define_schedule() {
     initSchedulingInfo();
 }
 
-void MKLDNNSnippetNode::generate() {
+std::vector<bool> MKLDNNSnippetNode::getBroadcastPattern() const {
+    const auto &body = snippet->get_body();
+    std::vector<bool> pattern;
+    for (const auto& p : body->get_parameters())
+        pattern.push_back(p->get_shape().back() == 1);
+    for (const auto& r : body->get_results())
+        pattern.push_back(r->get_input_shape(0).back() == 1);
+    return pattern;
+}
+
+MKLDNNSnippetNode::ShapeAgnosticKernel MKLDNNSnippetNode::generate_shape_agnostic() {
     jit_snippets_compile_args jcp;
+    jcp.runtime_schedule = true;
     jcp.output_dims = exec_domain;
-    std::copy(sch_dims.begin(), sch_dims.end(), jcp.scheduler_dims);
-    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), jcp.scheduler_offsets);
-    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &jcp.scheduler_offsets[sch_offsets_in.size()]);
-    size_t harness_num_dims = jcp.output_dims.size() - 1;
+    const size_t harness_num_dims = jcp.output_dims.size() - 1;
     if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS) {
         canUseOptimizedImpl = false;
-        harness_num_dims = SNIPPETS_MAX_HARNESS_DIMS;
+        return {};
     }
+    // The canonicalized body of the snippet can't be canonicalized again after the code generation,
+    // so the code is generated for the copy which keeps the generated code alive
+    ShapeAgnosticKernel shapeAgnosticKernel;
+    shapeAgnosticKernel.subgraph = copySnippet(snippet, host_isa);
+    shapeAgnosticKernel.schedule = shapeAgnosticKernel.subgraph->generate(output_blocked_shapes, input_blocked_shapes,
+                                                                          reinterpret_cast<void*>(&jcp));
+    return shapeAgnosticKernel;
+}
+
+void MKLDNNSnippetNode::init_schedule_args(int64_t* scheduler_dims, int64_t* scheduler_offsets, int64_t* data_offsets,
+                                           size_t harness_num_dims) const {
+    std::copy(sch_dims.begin(), sch_dims.end(), scheduler_dims);
+    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), scheduler_offsets);
+    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &scheduler_offsets[sch_offsets_in.size()]);
     for (size_t i = 0; i < inputShapes.size(); i++) {
         auto b = offsets_in[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[i * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &data_offsets[i * harness_num_dims]);
     }
     for (size_t i = 0; i < outputShapes.size(); i++) {
         auto b = offsets_out[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &data_offsets[(inputShapes.size() + i) * harness_num_dims]);
+    }
+}
+
+void MKLDNNSnippetNode::generate() {
+    jit_snippets_compile_args jcp;
+    jcp.output_dims = exec_domain;
+    size_t harness_num_dims = jcp.output_dims.size() - 1;
+    if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS) {
+        canUseOptimizedImpl = false;
+        harness_num_dims = SNIPPETS_MAX_HARNESS_DIMS;
     }
+    init_schedule_args(jcp.scheduler_dims, jcp.scheduler_offsets, jcp.data_offsets, harness_num_dims);
     schedule = snippet->generate(reinterpret_cast<void*>(&jcp));
 }
 
@@ -14,6 +14,7 @@
 #include "snippets/op/subgraph.hpp"
 
 #include <array>
+#include <unordered_map>
 
 namespace ov {
 namespace intel_cpu {
@@ -39,22 +40,49 @@ public:
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(mkldnn::stream strm) override;
 
+protected:
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
 private:
     static const size_t rank6D {6};
 
     typedef void (*kernel)(const void *, const void *);
 
+    // Kernel generated for dynamic shapes, the subgraph copy owns the generator which holds the code
+    struct ShapeAgnosticKernel {
+        std::shared_ptr<ngraph::snippets::op::Subgraph> subgraph;
+        ngraph::snippets::Schedule schedule;
+    };
+
     void define_schedule();
 
     void generate();
+    // Generates the kernel which reads work amounts and offsets from the call args, so it may be reused for any shapes
+    // with the same broadcasting pattern (see getBroadcastPattern)
+    ShapeAgnosticKernel generate_shape_agnostic();
+    // Copies the schedule defined for the current shapes either to the compile args or to the call args
+    void init_schedule_args(int64_t* scheduler_dims, int64_t* scheduler_offsets, int64_t* data_offsets,
+                            size_t harness_num_dims) const;
+    // Whether the last dim of each canonicalized parameter and result is equal to 1. The generated code depends
+    // only on it: broadcasting is handled by the scalar loads and the pointers increments are decided by these dims
+    std::vector<bool> getBroadcastPattern() const;
 
     // Evaluates generated snippet using parallel backend
     void schedule_6d(const jit_snippets_call_args& const_args) const;
     void schedule_nt(const jit_snippets_call_args& const_args) const;
 
     // Local copy of subgraph node for canonization & code generation
+    // in case of dynamic shapes it's only canonicalized, the code is generated for its copies
     std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
+    ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes = {};
+    ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes = {};
+
+    std::unordered_map<std::vector<bool>, ShapeAgnosticKernel> shapeAgnosticKernels;
+    // Work amounts and offsets of the current shapes passed to the shape agnostic kernel
+    jit_snippets_call_args runtimeArgs;
+
     // Holds generated snippet with information about how to schedule it
     ngraph::snippets::Schedule schedule;
 
@@ -88,6 +116,7 @@ private:
     std::vector<int64_t> sch_offsets_in = {};
     std::vector<int64_t> sch_offsets_out = {};
     bool canUseOptimizedImpl = true;
+    bool hasReductions = false;
 };
 
 }   // namespace intel_cpu
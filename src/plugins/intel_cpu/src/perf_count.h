@@ -4,12 +4,93 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <memory>
 #include <ratio>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * Latency histogram with log-linear buckets: every power of two range of nanoseconds is split into
+ * subBuckets linear buckets, so a percentile is reported with a relative error below 1 / subBuckets.
+ * The counters are updated with relaxed atomics only, so the reader never blocks the inference thread.
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t subBucketBits = 3;
+    static constexpr size_t subBuckets = 1 << subBucketBits;
+    // the durations above 2^41 ns (~37 min) are counted in the last bucket
+    static constexpr size_t octaves = 41 - subBucketBits;
+    static constexpr size_t bucketsNum = (octaves + 1) * subBuckets;
+
+    using Counts = std::vector<uint64_t>;
+
+    LatencyHistogram() {
+        for (auto& bucket : buckets)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+
+    void add(uint64_t ns) {
+        buckets[bucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // adds the current counts to the ones from the other streams
+    void accumulate(Counts& counts) const {
+        counts.resize(bucketsNum, 0);
+        for (size_t i = 0; i < bucketsNum; i++)
+            counts[i] += buckets[i].load(std::memory_order_relaxed);
+    }
+
+    // returns the upper bound in ns of the bucket containing the p-th percentile, p is in [0, 1]
+    static uint64_t percentile(const Counts& counts, double p) {
+        uint64_t total = 0;
+        for (auto count : counts)
+            total += count;
+        if (total == 0)
+            return 0;
+
+        const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(p * total + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            seen += counts[i];
+            if (seen >= rank)
+                return bucketUpperBound(i);
+        }
+        return bucketUpperBound(counts.size() - 1);
+    }
+
+    static size_t bucketIndex(uint64_t ns) {
+        if (ns < subBuckets)
+            return static_cast<size_t>(ns);
+        size_t msb = 0;
+        for (size_t shift = 32; shift; shift >>= 1) {
+            if (ns >> (msb + shift))
+                msb += shift;
+        }
+        const size_t octave = msb - subBucketBits + 1;
+        if (octave > octaves)
+            return bucketsNum - 1;
+        const size_t sub = static_cast<size_t>(ns >> (msb - subBucketBits)) & (subBuckets - 1);
+        return octave * subBuckets + sub;
+    }
+
+    static uint64_t bucketUpperBound(size_t idx) {
+        const size_t octave = idx / subBuckets;
+        const uint64_t sub = idx % subBuckets;
+        if (octave == 0)
+            return sub + 1;
+        return (subBuckets + sub + 1) << (octave - 1);
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, bucketsNum> buckets;
+};
+
 class PerfCount {
     uint64_t total_duration;
     uint32_t num;
@@ -17,6 +98,8 @@ class PerfCount {
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    std::unique_ptr<LatencyHistogram> histogram;
+
 public:
     PerfCount(): total_duration(0), num(0) {}
 
@@ -26,6 +109,13 @@ public:
 
     uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
 
+    void enableHistogram() {
+        if (!histogram)
+            histogram.reset(new LatencyHistogram());
+    }
+
+    const LatencyHistogram* getHistogram() const { return histogram.get(); }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -35,6 +125,8 @@ private:
         __finish = std::chrono::high_resolution_clock::now();
         total_duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
         num++;
+        if (histogram)
+            histogram->add(std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count());
     }
 
     friend class PerfHelper;
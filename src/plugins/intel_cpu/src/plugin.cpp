@@ -20,6 +20,7 @@
 #include <tuple>
 #include <unordered_set>
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
 #include <nodes/list.hpp>
 #include <ie_ngraph_utils.hpp>
 
@@ -84,6 +85,7 @@
 #include <transformations/utils/utils.hpp>
 #include <snippets/pass/collapse_subgraph.hpp>
 #include "ngraph_transformations/snippets_mark_skipped.hpp"
+#include "ngraph_transformations/mark_weights_decompression.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset2.hpp>
@@ -191,6 +193,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
             defaultPrecisions = ngraph::pass::low_precision::precision_set::int8_int16_int32_support;
         }
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(defaultPrecisions);
+    } else {
+        // the compressed weights and embedding tables are kept as is to be decompressed by FullyConnected and EmbeddingBag
+        manager.register_pass<MarkWeightsDecompression>();
+        manager.register_pass<MarkEmbeddingTableDecompression>();
     }
     auto get_convert_precisions = []() {
         precisions_array array = {
@@ -231,7 +237,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     manager.register_pass<ngraph::pass::ConvertMulticlassNmsToMulticlassNmsIE>();
     manager.register_pass<ngraph::pass::ConvertMatrixNmsToMatrixNmsIE>();
     manager.register_pass<ngraph::pass::TransposeMatMul>();
-    manager.register_pass<ngraph::pass::ConstantFolding>();
+    // the independent constant sub-graphs (e.g. the weights decompression) are evaluated by the plugin threads
+    manager.register_pass<ngraph::pass::ConstantFolding>([](size_t workAmount, const std::function<void(size_t)>& body) {
+        InferenceEngine::parallel_for(workAmount, body);
+    });
 
     if (useLpt) {
         manager.register_pass<ngraph::pass::low_precision::ConvertSubtractConstant>(defaultPrecisions);
@@ -423,6 +432,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         pass_config->set_callback<ngraph::pass::ConvertSubtract>([&defaultPrecisions](const_node_ptr &node) -> bool {
             return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForSubtract(node, defaultPrecisions);
         });
+    } else {
+        pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
+            return isWeightsDecompressionConvert(node->get_input_node_shared_ptr(0));
+        });
     }
 
     manager.run_passes(nGraphFunc);
@@ -529,7 +542,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                                       });
                     // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                     auto rank_is_too_large = [](const ov::descriptor::Tensor& t ) {
-                        // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                        // callback is called has_supported_in_out(), so it's safe to assume that the ranks are static
                         return t.get_partial_shape().rank().get_length() > 6;
                     };
                     const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -4,6 +4,7 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <ie_mapped_memory_stream.hpp>
 
 #include <pugixml.hpp>
 
@@ -65,6 +66,28 @@ namespace {
             it->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    // Exposes a part of the mapped compiled blob as a blob buffer and keeps the mapping alive
+    class MappedRegionAllocator : public InferenceEngine::IAllocator {
+    public:
+        MappedRegionAllocator(std::shared_ptr<ov::util::MappedMemory> memory, size_t offset)
+            : _memory(std::move(memory)), _offset(offset) {}
+
+        void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+            return handle;
+        }
+        void unlock(void*) noexcept override {}
+        void* alloc(size_t size) noexcept override {
+            return _offset + size <= _memory->size() ? _memory->data() + _offset : nullptr;
+        }
+        bool free(void*) noexcept override {
+            return true;
+        }
+
+    private:
+        std::shared_ptr<ov::util::MappedMemory> _memory;
+        size_t _offset;
+    };
 };  // namespace
 
 CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager)
@@ -152,10 +175,18 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        const InferenceEngine::TensorDesc dataDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        if (auto mappedStream = dynamic_cast<MappedMemoryStream*>(&_istream)) {
+            // constants reference the mapped blob, so their pages are loaded on demand and shared between processes
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(dataDesc,
+                std::make_shared<MappedRegionAllocator>(mappedStream->getMemory(), hdr.consts_offset));
+            dataBlob->allocate();
+        }
+        if (!dataBlob || dataBlob->buffer().as<char*>() == nullptr) {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(dataDesc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -0,0 +1,108 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "data_hash.hpp"
+
+#include <cstring>
+#if defined(HAVE_SSE42)
+#include <immintrin.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+namespace {
+
+constexpr size_t kLanes = 4;
+constexpr size_t kWordSize = sizeof(uint64_t);
+constexpr size_t kBlockSize = kLanes * kWordSize;
+
+inline uint64_t load_word(const unsigned char* data) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+#if defined(HAVE_SSE42)
+
+inline uint32_t crc32c_u8(uint32_t crc, unsigned char value) {
+    return _mm_crc32_u8(crc, value);
+}
+
+inline uint32_t crc32c_u64(uint32_t crc, uint64_t value) {
+#if defined(__x86_64__) || defined(_M_X64)
+    return static_cast<uint32_t>(_mm_crc32_u64(crc, value));
+#else
+    crc = _mm_crc32_u32(crc, static_cast<uint32_t>(value));
+    return _mm_crc32_u32(crc, static_cast<uint32_t>(value >> 32));
+#endif
+}
+
+#else
+
+// Slicing-by-8 tables for the reflected CRC32C polynomial, the same one the crc32 instruction implements
+struct Crc32cTables {
+    Crc32cTables() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int j = 0; j < 8; j++)
+                c = ((c & 1) ? 0x82f63b78 : 0) ^ (c >> 1);
+            table[0][i] = c;
+        }
+        for (uint32_t i = 0; i < 256; i++) {
+            for (int k = 1; k < 8; k++)
+                table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xff];
+        }
+    }
+
+    uint32_t table[8][256];
+};
+
+const Crc32cTables& tables() {
+    static const Crc32cTables crcTables;
+    return crcTables;
+}
+
+inline uint32_t crc32c_u8(uint32_t crc, unsigned char value) {
+    return tables().table[0][(crc ^ value) & 0xff] ^ (crc >> 8);
+}
+
+inline uint32_t crc32c_u64(uint32_t crc, uint64_t value) {
+    const auto& t = tables().table;
+    const uint32_t lo = crc ^ static_cast<uint32_t>(value);
+    const uint32_t hi = static_cast<uint32_t>(value >> 32);
+    return t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^ t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+           t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^ t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+}
+
+#endif
+
+}  // namespace
+
+uint64_t hash_data(const unsigned char* data, size_t size) {
+    // The lanes have independent dependency chains, which hides the latency of the crc32 instruction
+    uint32_t lanes[kLanes] = {0xffffffff, 0xfffffffe, 0xfffffffd, 0xfffffffc};
+
+    size_t idx = 0;
+    for (; idx + kBlockSize <= size; idx += kBlockSize) {
+        lanes[0] = crc32c_u64(lanes[0], load_word(data + idx));
+        lanes[1] = crc32c_u64(lanes[1], load_word(data + idx + kWordSize));
+        lanes[2] = crc32c_u64(lanes[2], load_word(data + idx + 2 * kWordSize));
+        lanes[3] = crc32c_u64(lanes[3], load_word(data + idx + 3 * kWordSize));
+    }
+    for (; idx + kWordSize <= size; idx += kWordSize)
+        lanes[0] = crc32c_u64(lanes[0], load_word(data + idx));
+    for (; idx < size; idx++)
+        lanes[1] = crc32c_u8(lanes[1], data[idx]);
+
+    // Fold the lanes and the data size into 64 bits
+    const uint32_t hi = crc32c_u64(lanes[0], (static_cast<uint64_t>(lanes[1]) << 32) | lanes[2]);
+    const uint32_t lo = crc32c_u64(lanes[3], static_cast<uint64_t>(size) ^ (static_cast<uint64_t>(hi) << 32));
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+}
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
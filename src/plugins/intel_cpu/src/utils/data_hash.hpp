@@ -0,0 +1,23 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+/**
+ * Computes 64-bit hash of the data. The data is processed by four interleaved CRC32C (Castagnoli) lanes
+ * over 8-byte words, so the hardware crc32 instruction is used when SSE4.2 is available. The software
+ * fallback produces exactly the same values.
+ */
+uint64_t hash_data(const unsigned char* data, size_t size);
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,179 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.hpp"
+
+#include <common/utils.hpp>
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+thread_local int currentNumaNode = -1;
+
+constexpr int cacheLineSize = 64;
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+#define CPU_NUMA_SYSCALLS
+
+// the values of <linux/mempolicy.h>, the kernel headers are not required to be installed
+constexpr int mpolPreferred = 1;
+constexpr int mpolInterleave = 3;
+constexpr unsigned mpolMfMove = 1 << 1;
+
+// the nodes above the single word mask are not supported
+constexpr int maxNumaNode = 8 * sizeof(unsigned long) - 1;
+
+// the pages are queried by the chunks to bound the temporary buffers
+constexpr size_t queryChunk = 1024;
+
+// the allocations starting from the default mmap threshold of glibc are mapped separately to own their pages
+constexpr size_t minMappedSize = 128 * 1024;
+
+size_t pageSize() {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+#endif
+
+}   // namespace
+
+bool bindToNumaNodes(void* ptr, size_t size, const std::vector<int>& numaNodes) {
+#ifdef CPU_NUMA_SYSCALLS
+    if (numaNodes.empty())
+        return false;
+    unsigned long nodeMask = 0;
+    for (auto node : numaNodes) {
+        if (node < 0 || node > maxNumaNode)
+            return false;
+        nodeMask |= 1ul << node;
+    }
+
+    const auto page = pageSize();
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + page - 1) / page * page;
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) / page * page;
+    if (begin >= end)
+        return true;
+
+    const int mode = numaNodes.size() == 1 ? mpolPreferred : mpolInterleave;
+    // the kernel takes the number of the mask bits plus one
+    return syscall(SYS_mbind, begin, end - begin, mode, &nodeMask, maxNumaNode + 2, mpolMfMove) == 0;
+#else
+    return false;
+#endif
+}
+
+void* allocNumaMemory(size_t size, const std::vector<int>& numaNodes) noexcept {
+#ifdef CPU_NUMA_SYSCALLS
+    if (size >= minMappedSize) {
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+            return nullptr;
+        bindToNumaNodes(ptr, size, numaNodes);
+        return ptr;
+    }
+#endif
+    return dnnl::impl::malloc(size, cacheLineSize);
+}
+
+void freeNumaMemory(void* ptr, size_t size) noexcept {
+    if (ptr == nullptr)
+        return;
+#ifdef CPU_NUMA_SYSCALLS
+    if (size >= minMappedSize) {
+        munmap(ptr, size);
+        return;
+    }
+#endif
+    dnnl::impl::free(ptr);
+}
+
+NumaPlacement getNumaPlacement(const std::vector<std::pair<const void*, size_t>>& regions, int numaNode) {
+    NumaPlacement placement;
+#ifdef CPU_NUMA_SYSCALLS
+    const auto page = pageSize();
+    std::vector<void*> pages;
+    for (const auto& region : regions) {
+        if (region.first == nullptr || region.second == 0)
+            continue;
+        const auto begin = reinterpret_cast<uintptr_t>(region.first) / page * page;
+        const auto end = reinterpret_cast<uintptr_t>(region.first) + region.second;
+        for (auto addr = begin; addr < end; addr += page)
+            pages.push_back(reinterpret_cast<void*>(addr));
+    }
+    std::sort(pages.begin(), pages.end());
+    pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+    std::vector<int> status(queryChunk);
+    for (size_t first = 0; first < pages.size(); first += queryChunk) {
+        const auto count = std::min(queryChunk, pages.size() - first);
+        // without the target nodes the call only reports the node of each page
+        if (syscall(SYS_move_pages, 0, count, &pages[first], nullptr, status.data(), 0) != 0)
+            continue;
+        for (size_t i = 0; i < count; i++) {
+            // the negative status is an error code, e.g. the page is not present yet
+            if (status[i] < 0)
+                continue;
+            if (status[i] == numaNode)
+                placement.localBytes += page;
+            else
+                placement.remoteBytes += page;
+        }
+    }
+#endif
+    return placement;
+}
+
+NumaNodeScope::NumaNodeScope(int numaNode) : previous(currentNumaNode) {
+    if (numaNode >= 0)
+        currentNumaNode = numaNode;
+}
+
+NumaNodeScope::~NumaNodeScope() {
+    currentNumaNode = previous;
+}
+
+int NumaNodeScope::current() {
+    return currentNumaNode;
+}
+
+void* NumaInterleavedAllocator::alloc(size_t size) noexcept {
+    void* ptr = allocNumaMemory(size, numaNodes);
+    if (ptr == nullptr)
+        return nullptr;
+    try {
+        std::lock_guard<std::mutex> lock(sizesMutex);
+        sizes[ptr] = size;
+    } catch (...) {
+        freeNumaMemory(ptr, size);
+        return nullptr;
+    }
+    return ptr;
+}
+
+bool NumaInterleavedAllocator::free(void* handle) noexcept {
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock(sizesMutex);
+        auto it = sizes.find(handle);
+        if (it == sizes.end())
+            return false;
+        size = it->second;
+        sizes.erase(it);
+    }
+    freeNumaMemory(handle, size);
+    return true;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
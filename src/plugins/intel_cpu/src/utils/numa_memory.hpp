@@ -0,0 +1,91 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Binds the whole pages of the memory region to the NUMA nodes: a single node is set as the preferred one,
+ * several nodes are interleaved. The pages not touched yet are allocated according to the policy on the first
+ * touch, the already touched ones are migrated. The partial pages at the region bounds are left as is, since
+ * they may belong to the other allocations.
+ * @return false if the binding is not supported by the platform or rejected by the system
+ */
+bool bindToNumaNodes(void* ptr, size_t size, const std::vector<int>& numaNodes);
+
+/**
+ * Allocates the memory bound to the NUMA nodes. The large allocations are page aligned, mapped by the allocator
+ * itself and bound before the first touch, so the policy covers the whole allocation and no pages are shared with
+ * the other allocations. The small ones are allocated as usual, since they mostly share the pages anyway.
+ * The memory is still returned if the binding is not supported. The memory has to be released by freeNumaMemory
+ * with the same size.
+ */
+void* allocNumaMemory(size_t size, const std::vector<int>& numaNodes) noexcept;
+void freeNumaMemory(void* ptr, size_t size) noexcept;
+
+struct NumaPlacement {
+    uint64_t localBytes = 0;
+    uint64_t remoteBytes = 0;
+};
+
+/**
+ * Splits the resident pages of the memory regions into the ones placed on the NUMA node and the remote ones.
+ * The pages shared by several regions are counted once, the pages not touched yet are skipped.
+ */
+NumaPlacement getNumaPlacement(const std::vector<std::pair<const void*, size_t>>& regions, int numaNode);
+
+/**
+ * Sets the NUMA node the memory allocated by MemoryMngrWithReuse on the current thread is bound to.
+ * The negative node id keeps the node of the enclosing scope, so the nested graphs inherit the node of the
+ * stream which executes them.
+ */
+class NumaNodeScope {
+public:
+    explicit NumaNodeScope(int numaNode);
+    ~NumaNodeScope();
+
+    NumaNodeScope(const NumaNodeScope&) = delete;
+    NumaNodeScope& operator=(const NumaNodeScope&) = delete;
+
+    static int current();
+
+private:
+    int previous;
+};
+
+/**
+ * Allocator of the infer request tensors. The requests are not owned by the streams (any stream may execute any
+ * request), so the tensors are interleaved between the NUMA nodes of the streams to balance the remote traffic.
+ */
+class NumaInterleavedAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit NumaInterleavedAllocator(std::vector<int> numaNodes) : numaNodes(std::move(numaNodes)) {}
+
+    void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+        return handle;
+    }
+    void unlock(void*) noexcept override {}
+    void* alloc(size_t size) noexcept override;
+    bool free(void* handle) noexcept override;
+
+private:
+    std::vector<int> numaNodes;
+    // the sizes of the allocations, since the memory is released by the handle only
+    std::unordered_map<void*, size_t> sizes;
+    std::mutex sizesMutex;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -3,13 +3,42 @@
 //
 
 #include "weights_cache.hpp"
+#include "utils/data_hash.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <file_utils.h>
 #include <memory>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <algorithm>
 
 namespace ov {
 namespace intel_cpu {
 
+constexpr size_t SimpleDataHash::kChunkSize;
+constexpr size_t SimpleDataHash::kParallelThreshold;
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size < kParallelThreshold)
+        return XARCH::hash_data(data, size);
+
+    // Chunk boundaries are fixed, so the hash is the same for any threads number
+    const size_t chunksNum = (size + kChunkSize - 1) / kChunkSize;
+    std::vector<uint64_t> chunkHashes(chunksNum + 1);
+    parallel_for(chunksNum, [&](size_t i) {
+        const size_t offset = i * kChunkSize;
+        chunkHashes[i] = XARCH::hash_data(data + offset, std::min(kChunkSize, size - offset));
+    });
+    chunkHashes[chunksNum] = size;
+
+    return XARCH::hash_data(reinterpret_cast<const unsigned char*>(chunkHashes.data()),
+                            chunkHashes.size() * sizeof(uint64_t));
+}
+
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
@@ -71,6 +100,119 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+void MKLDNNWeightsSharing::retain(const std::shared_ptr<ov::util::MappedMemory>& mappedData) {
+    std::unique_lock<std::mutex> lock(guard);
+    retainedData.push_back(mappedData);
+}
+
+namespace {
+
+constexpr char storageMagic[8] = {'O', 'V', 'C', 'P', 'U', 'W', 'S', '1'};
+
+// the data of the entry which follow the header
+class MappedEntryData : public ov::util::MappedMemory {
+public:
+    MappedEntryData(std::shared_ptr<ov::util::MappedMemory> entry, size_t offset)
+        : entry(std::move(entry)), offset(offset) {}
+
+    char* data() noexcept override {
+        return entry->data() + offset;
+    }
+    size_t size() const noexcept override {
+        return entry->size() - offset;
+    }
+
+private:
+    std::shared_ptr<ov::util::MappedMemory> entry;
+    size_t offset;
+};
+
+}   // namespace
+
+constexpr size_t MKLDNNWeightsStorage::headerSize;
+
+MKLDNNWeightsStorage::MKLDNNWeightsStorage(std::string dir) : dir(std::move(dir)) {
+    FileUtils::createDirectoryRecursive(this->dir);
+}
+
+MKLDNNWeightsStorage::Key MKLDNNWeightsStorage::makeKey(const MKLDNNMemory& src, const MemoryDesc& dstDesc) {
+    auto serializeDesc = [](const MemoryDesc& desc) {
+        return desc.getPrecision().name() + std::string("_") + desc.getShape().toString() + "_" + desc.serializeFormat();
+    };
+
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    const std::string descs = serializeDesc(src.getDesc()) + "->" + serializeDesc(dstDesc);
+    const uint64_t dataHash = hashFunc.hash(static_cast<const unsigned char*>(src.GetData()), src.GetSize());
+    const uint64_t descsHash = hashFunc.hash(reinterpret_cast<const unsigned char*>(descs.data()), descs.size());
+
+    Key key;
+    std::stringstream name;
+    name << std::hex << dataHash << "_" << descsHash << "_" << std::dec << src.GetSize();
+    key.name = name.str();
+    key.header = descs + "_" + std::to_string(src.GetSize());
+    return key;
+}
+
+std::string MKLDNNWeightsStorage::entryPath(const std::string& name) const {
+    return FileUtils::makePath(dir, name + ".blob");
+}
+
+std::shared_ptr<ov::util::MappedMemory> MKLDNNWeightsStorage::find(const Key& key, size_t size) const {
+    const auto path = entryPath(key.name);
+    if (!FileUtils::fileExist(path))
+        return nullptr;
+
+    std::shared_ptr<ov::util::MappedMemory> mapped;
+    try {
+        mapped = ov::util::load_mmap_object(path);
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+    // an entry of unexpected size is treated as a corrupted one
+    if (mapped->size() != headerSize + size)
+        return nullptr;
+
+    // the entry created from the other data with the same hash is rejected by the header
+    const char* header = mapped->data();
+    uint64_t headerLength = 0;
+    std::memcpy(&headerLength, header + sizeof(storageMagic), sizeof(headerLength));
+    if (std::memcmp(header, storageMagic, sizeof(storageMagic)) != 0 || headerLength != key.header.size() ||
+        key.header.compare(0, key.header.size(), header + sizeof(storageMagic) + sizeof(headerLength), headerLength) != 0)
+        return nullptr;
+
+    return std::make_shared<MappedEntryData>(mapped, headerSize);
+}
+
+void MKLDNNWeightsStorage::store(const Key& key, const MKLDNNMemory& memory) const {
+    std::vector<char> header(headerSize, 0);
+    const uint64_t headerLength = key.header.size();
+    if (sizeof(storageMagic) + sizeof(headerLength) + headerLength > headerSize)
+        return;
+    std::memcpy(header.data(), storageMagic, sizeof(storageMagic));
+    std::memcpy(header.data() + sizeof(storageMagic), &headerLength, sizeof(headerLength));
+    std::memcpy(header.data() + sizeof(storageMagic) + sizeof(headerLength), key.header.data(), headerLength);
+
+    // The entry is written to a unique temporary file and then renamed, so a concurrent
+    // process either sees a complete entry or does not see it at all
+    std::random_device rd;
+    const auto path = entryPath(key.name);
+    const auto tmpPath = path + "." + std::to_string(rd()) + ".tmp";
+    {
+        std::ofstream stream(tmpPath, std::ios::binary);
+        if (!stream.is_open())
+            return;
+        stream.write(header.data(), header.size());
+        stream.write(static_cast<const char*>(memory.GetData()), memory.GetSize());
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        std::remove(tmpPath.c_str());
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "openvino/util/mmap_object.hpp"
 
 #include <unordered_map>
 #include <functional>
@@ -13,6 +14,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -25,26 +27,15 @@ namespace intel_cpu {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    /**
+     * Computes 64-bit hash of the data using the best instruction set available on the host.
+     * Buffers larger than kParallelThreshold are split into kChunkSize chunks which are hashed in parallel,
+     * the result does not depend on the number of threads.
+     */
+    uint64_t hash(const unsigned char* data, size_t size) const;
+
+    static constexpr size_t kChunkSize = 1 << 20;
+    static constexpr size_t kParallelThreshold = 4 * kChunkSize;
 };
 
 /**
@@ -94,14 +85,62 @@ public:
 
     MKLDNNSharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Keeps the mapped data alive while the cache exists,
+     * so the cached memory objects may point into the entries of the persistent storage
+     */
+    void retain(const std::shared_ptr<ov::util::MappedMemory>& mappedData);
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
+    std::vector<std::shared_ptr<ov::util::MappedMemory>> retainedData;
     static const SimpleDataHash simpleCRC;
 };
 
+/**
+ * File backed storage of the constant data shared between processes
+ * Entries are addressed by the hash of the data they were created from and by the target memory
+ * descriptor, so the processes running the same model on a host create the data only once and
+ * map the stored copy afterwards. The hash is not collision proof, so every entry starts with a page
+ * holding the source and target descriptors and the source size, which are verified on lookup.
+ * The storage directory may be placed on a tmpfs (e.g. /dev/shm) to keep the data in shared memory.
+ *
+ * Is a thread and process safe
+ */
+class MKLDNNWeightsStorage {
+public:
+    typedef std::shared_ptr<MKLDNNWeightsStorage> Ptr;
+
+    struct Key {
+        // the name of the entry file
+        std::string name;
+        // the description of the source and target data stored in the entry header
+        std::string header;
+
+        bool empty() const {
+            return name.empty();
+        }
+    };
+
+    explicit MKLDNNWeightsStorage(std::string dir);
+
+    static Key makeKey(const MKLDNNMemory& src, const MemoryDesc& dstDesc);
+
+    std::shared_ptr<ov::util::MappedMemory> find(const Key& key, size_t size) const;
+    void store(const Key& key, const MKLDNNMemory& memory) const;
+
+private:
+    // the header is padded to the page, so the mapped data stay page aligned
+    static constexpr size_t headerSize = 4096;
+
+    std::string entryPath(const std::string& name) const;
+
+    std::string dir;
+};
+
 /**
  * Collection of memory caching store per NUMA node(former socket)
  *
@@ -15,6 +15,10 @@
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/unicode_utils.hpp"
 #include <ngraph/ngraph.hpp>
+#include <openvino/runtime/core.hpp>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
 TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromFile) {
     InferenceEngine::Core ie;
@@ -76,6 +80,87 @@ TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromStringException) {
     }
 }
 
+namespace {
+void copyModelFile(const std::string& src, const std::string& dst) {
+    std::ifstream src_file(src, std::ios::binary);
+    std::ofstream dst_file(dst, std::ios::binary);
+    dst_file << src_file.rdbuf();
+}
+
+// Copies the model and its external data file into the separate directory, so the data file can be modified.
+std::string copyModelWithExternalData(const std::string& model_name, const std::string& dir_name) {
+    const auto src_dir = CommonTestUtils::getModelFromTestModelZoo(std::string(ONNX_TEST_MODELS));
+    const auto dst_dir = src_dir + dir_name + "/";
+    CommonTestUtils::createDirectoryRecursive(dst_dir + "data");
+    copyModelFile(src_dir + model_name, dst_dir + model_name);
+    copyModelFile(src_dir + "data/tensor.data", dst_dir + "data/tensor.data");
+    return dst_dir;
+}
+
+void removeModelWithExternalData(const std::string& dir, const std::string& model_name) {
+    CommonTestUtils::removeFile(dir + "data/tensor.data");
+    CommonTestUtils::removeFile(dir + model_name);
+    CommonTestUtils::removeDir(dir + "data");
+    CommonTestUtils::removeDir(dir);
+}
+
+std::vector<float> getExternalDataValues(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& op : model->get_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op))
+            return constant->cast_vector<float>();
+    }
+    return {};
+}
+}  // namespace
+
+TEST(ONNX_Reader_Tests, ImportModelWithExternalDataMmapEnabled) {
+    ov::Core core;
+    core.set_property(ov::enable_mmap(true));
+    const auto model = core.read_model(CommonTestUtils::getModelFromTestModelZoo(
+        std::string(ONNX_TEST_MODELS) + "onnx_external_data.onnx"));
+
+    ASSERT_EQ(getExternalDataValues(model), (std::vector<float>{1, 2, 3, 4}));
+}
+
+TEST(ONNX_Reader_Tests, ImportModelWithExternalDataMmapDisabled) {
+    const std::string model_name = "onnx_external_data.onnx";
+    const auto dir = copyModelWithExternalData(model_name, "mmap_disabled");
+
+    ov::Core core;
+    core.set_property(ov::enable_mmap(false));
+    const auto model = core.read_model(dir + model_name);
+
+    // the data is read into memory, so the modification of the file doesn't reach the model
+    std::vector<float> new_data{5, 6, 7, 8};
+    {
+        std::ofstream data_file(dir + "data/tensor.data", std::ios::binary | std::ios::in | std::ios::out);
+        data_file.write(reinterpret_cast<const char*>(new_data.data()), new_data.size() * sizeof(float));
+    }
+    const auto values = getExternalDataValues(model);
+    removeModelWithExternalData(dir, model_name);
+
+    ASSERT_EQ(values, (std::vector<float>{1, 2, 3, 4}));
+}
+
+#ifndef _WIN32
+TEST(ONNX_Reader_Tests, ImportModelWithExternalDataMmapFailed) {
+    // the external data is a device which can't be mapped, so the data is read
+    const std::string model_name = "onnx_external_data_zeros.onnx";
+    const auto dir = copyModelWithExternalData(model_name, "mmap_failed");
+    ASSERT_EQ(symlink("/dev/zero", (dir + "data/zeros.data").c_str()), 0);
+
+    ov::Core core;
+    core.set_property(ov::enable_mmap(true));
+    std::shared_ptr<ov::Model> model;
+    EXPECT_NO_THROW(model = core.read_model(dir + model_name));
+    const auto values = model ? getExternalDataValues(model) : std::vector<float>{};
+    CommonTestUtils::removeFile(dir + "data/zeros.data");
+    removeModelWithExternalData(dir, model_name);
+
+    ASSERT_EQ(values, (std::vector<float>{0, 0, 0, 0}));
+}
+#endif
+
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromWstringNamedFile) {
     InferenceEngine::Core ie;
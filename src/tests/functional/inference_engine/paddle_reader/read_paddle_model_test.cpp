@@ -9,6 +9,7 @@
 
 #include <ie_blob.h>
 #include <ie_core.hpp>
+#include <openvino/runtime/core.hpp>
 #include <file_utils.h>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/opsets/opset8.hpp>
@@ -47,6 +48,17 @@ TEST(Paddle_Reader_Tests, ImportBasicModelToCore) {
     ASSERT_TRUE(res.valid) << res.message;
 }
 
+TEST(Paddle_Reader_Tests, ImportBasicModelToCoreMmapEnabled) {
+    // the mmap flag is not passed to the frontends which don't support it
+    ov::Core core;
+    core.set_property(ov::enable_mmap(true));
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(std::string(PADDLE_TEST_MODELS) + "relu.pdmodel"));
+    ASSERT_NE(nullptr, model);
+    ASSERT_EQ(1, model->get_parameters().size());
+    ASSERT_EQ(1, model->get_results().size());
+}
+
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 TEST(Paddle_Reader_Tests, ImportBasicModelToCoreWstring) {
     std::string win_dir_path{ PADDLE_TEST_MODELS "relu.pdmodel" };
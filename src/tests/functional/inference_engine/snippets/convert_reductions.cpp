@@ -0,0 +1,97 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/opsets/opset8.hpp>
+
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/convert_reductions.hpp>
+
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+TEST(TransformationTests, SoftmaxDecomposition) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 17});
+        auto softmax = std::make_shared<opset8::Softmax>(data, -1);
+        f = std::make_shared<Function>(NodeVector{softmax}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::SoftmaxDecomposition>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 17});
+        auto max = std::make_shared<snippets::op::Reduce>(data, snippets::op::Reduce::Type::Max);
+        auto sub = std::make_shared<opset1::Subtract>(data, max);
+        auto exp = std::make_shared<opset1::Exp>(sub);
+        auto sum = std::make_shared<snippets::op::Reduce>(exp, snippets::op::Reduce::Type::Sum);
+        auto div = std::make_shared<opset1::Divide>(exp, sum);
+        f_ref = std::make_shared<Function>(NodeVector{div}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertReduceMean) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 16});
+        auto axes = opset1::Constant::create(element::i64, Shape{1}, {2});
+        auto mean = std::make_shared<opset1::ReduceMean>(data, axes, true);
+        f = std::make_shared<Function>(NodeVector{mean}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::ConvertReductions>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 16});
+        auto sum = std::make_shared<snippets::op::Reduce>(data, snippets::op::Reduce::Type::Sum);
+        auto scale = std::make_shared<snippets::op::Scalar>(element::f32, Shape{1}, 1.f / 16);
+        auto mul = std::make_shared<opset1::Multiply>(sum, scale);
+        f_ref = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertReductionsSkipsNonInnermostAxis) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 16});
+        auto axes = opset1::Constant::create(element::i64, Shape{1}, {1});
+        auto sum = std::make_shared<opset1::ReduceSum>(data, axes, true);
+        f = std::make_shared<Function>(NodeVector{sum}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::ConvertReductions>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 16});
+        auto axes = opset1::Constant::create(element::i64, Shape{1}, {1});
+        auto sum = std::make_shared<opset1::ReduceSum>(data, axes, true);
+        f_ref = std::make_shared<Function>(NodeVector{sum}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
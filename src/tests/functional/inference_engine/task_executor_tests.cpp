@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <future>
 
 #include <gtest/gtest.h>
@@ -140,6 +141,97 @@ TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     ASSERT_EQ(MAX_NUMBER_OF_TASKS_IN_QUEUE, sharedVar);
 }
 
+// Many small tasks from many threads: no task is lost under the contention on the executor queues
+TEST_P(TaskExecutorTests, canRunManySmallTasksFromManyThreads) {
+    auto taskExecutor = GetParam()();
+    const int PRODUCERS_NUMBER = 8;
+    const int TASKS_PER_PRODUCER = 20000;
+    std::atomic_int sharedVar = {0};
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < PRODUCERS_NUMBER; i++) {
+        producers.emplace_back([&] {
+            for (int k = 0; k < TASKS_PER_PRODUCER; k++) {
+                taskExecutor->run([&] {
+                    if (++sharedVar == PRODUCERS_NUMBER * TASKS_PER_PRODUCER) {
+                        std::lock_guard<std::mutex> lock{mutex};
+                        cv.notify_all();
+                    }
+                });
+            }
+        });
+    }
+    for (auto&& producer : producers) producer.join();
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        cv.wait(lock, [&] { return sharedVar == PRODUCERS_NUMBER * TASKS_PER_PRODUCER; });
+    }
+    ASSERT_EQ(PRODUCERS_NUMBER * TASKS_PER_PRODUCER, sharedVar);
+}
+
+// Measures the throughput of the small tasks under the contention on the executor queues, the result is reported
+// by the test properties (e.g. --gtest_output=xml)
+TEST_P(TaskExecutorTests, DISABLED_ManySmallTasksFromManyThreadsPerf) {
+    auto taskExecutor = GetParam()();
+    const int PRODUCERS_NUMBER = 8;
+    const int TASKS_PER_PRODUCER = 200000;
+    std::atomic_int sharedVar = {0};
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (int i = 0; i < PRODUCERS_NUMBER; i++) {
+        producers.emplace_back([&] {
+            for (int k = 0; k < TASKS_PER_PRODUCER; k++) {
+                taskExecutor->run([&] {
+                    if (++sharedVar == PRODUCERS_NUMBER * TASKS_PER_PRODUCER) {
+                        std::lock_guard<std::mutex> lock{mutex};
+                        cv.notify_all();
+                    }
+                });
+            }
+        });
+    }
+    for (auto&& producer : producers) producer.join();
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        cv.wait(lock, [&] { return sharedVar == PRODUCERS_NUMBER * TASKS_PER_PRODUCER; });
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_EQ(PRODUCERS_NUMBER * TASKS_PER_PRODUCER, sharedVar);
+    RecordProperty("tasks_per_second", std::to_string(PRODUCERS_NUMBER * TASKS_PER_PRODUCER / elapsed.count()));
+}
+
+// The tasks which don't fit into the stream queue are not overtaken by the later ones
+TEST(CPUStreamsExecutorTests, singleStreamKeepsOrderOnOverflow) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    const size_t TASKS_NUMBER = 5000;
+    std::vector<size_t> order;
+    std::promise<void> blocked;
+    auto blockedFuture = blocked.get_future();
+    std::promise<void> done;
+
+    // the first task holds the stream until the queue overflows, then the tasks are enqueued while it is drained
+    taskExecutor->run([&] { blockedFuture.wait(); });
+    for (size_t i = 0; i < TASKS_NUMBER; i++) {
+        if (i == TASKS_NUMBER / 2)
+            blocked.set_value();
+        taskExecutor->run([&, i] {
+            order.push_back(i);
+            if (order.size() == TASKS_NUMBER)
+                done.set_value();
+        });
+    }
+    done.get_future().wait();
+    ASSERT_EQ(TASKS_NUMBER, order.size());
+    for (size_t i = 0; i < TASKS_NUMBER; i++)
+        ASSERT_EQ(i, order[i]);
+}
+
 class ASyncTaskExecutorTests : public TaskExecutorTests {};
 
 // TODO: Issue-11695
@@ -190,6 +282,12 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
+    [] {
+        // more streams than cores to stress the stealing between the streams queues
+        auto streams = 32;
+        return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                               streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    },
     [] {
         auto streams = getNumberOfCPUCores();
         auto threads = parallel_get_max_threads();
@@ -18,6 +18,23 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test,
                 ::testing::ValuesIn(num_requests),
                 ::testing::ValuesIn(num_batch)),
                          AutoBatching_Test::getTestCaseName);
+
+// the number of requests is not multiple of the batch, so the partial batches are executed with the lower-batch variants
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_Adaptive,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::ValuesIn(get_vs_set),
+                ::testing::Values(1),
+                ::testing::Values(3, 7, 13),
+                ::testing::Values(4, 8, 16)),
+                         AutoBatching_Test_Adaptive::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_NotBatchableBlobs,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::Values(1, 5, 8),
+                ::testing::Values(4)),
+                         AutoBatching_Test_NotBatchableBlobs::getTestCaseName);
 // TODO: for 22.2 (CVS-68949)
 //INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_DetectionOutput,
 //                         ::testing::Combine(
@@ -31,7 +31,7 @@ const std::vector<std::vector<int64_t>> axes1D = {
 };
 
 const std::vector<std::vector<int64_t>> signalSizes1D = {
-    {}, {16}, {40}
+    {}, {16}, {40}, {17}, {97}
 };
 
 const auto testCase1D = ::testing::Combine(
@@ -49,7 +49,7 @@ const std::vector<std::vector<int64_t>> axes2D = {
     {0, 1}, {2, 1}, {2, 3}, {2, 0}, {1, 3}, {-1, -2}
 };
 const std::vector<std::vector<int64_t>> signalSizes2D = {
-    {}, {5, 7}, {4, 10}, {16, 8}
+    {}, {5, 7}, {4, 10}, {16, 8}, {19, 23}
 };
 
 const auto testCase2D = ::testing::Combine(
@@ -2,12 +2,29 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
+#include <string>
 #include <vector>
 #include "single_layer_tests/experimental_detectron_detection_output.hpp"
 
 using namespace ov::test;
 using namespace ov::test::subgraph;
 
+// Measures the inference of the large proposal counts, the time is reported by the test properties
+// (e.g. --gtest_output=xml). The accuracy is checked by the nightly instantiation of the same parameters.
+TEST_P(ExperimentalDetectronDetectionOutputRandomLayerTest, DISABLED_InferencePerf) {
+    compile_model();
+    generate_inputs(targetStaticShapes.front());
+    // the first inference creates the request and sets the inputs
+    infer();
+    const size_t iterations = 20;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+        inferRequest.infer();
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    RecordProperty("us_per_infer", std::to_string(elapsed.count() / iterations));
+}
+
 namespace {
 
 const std::vector<float> score_threshold = { 0.01000000074505806f };
@@ -66,4 +83,26 @@ INSTANTIATE_TEST_SUITE_P(smoke_ExperimentalDetectronDetectionOutput, Experimenta
                  ::testing::Values(CommonTestUtils::DEVICE_CPU)),
          ExperimentalDetectronDetectionOutputLayerTest::getTestCaseName);
 
+// Mask R-CNN like configuration with the large proposal counts
+const std::vector<std::vector<InputShape>> inputShapesProposals = {
+        static_shapes_to_test_representation({{1000, 4}, {1000, 324}, {1000, 81}, {1, 3}}),
+        static_shapes_to_test_representation({{2000, 4}, {2000, 324}, {2000, 81}, {1, 3}}),
+        static_shapes_to_test_representation({{5000, 4}, {5000, 324}, {5000, 81}, {1, 3}}),
+};
+
+INSTANTIATE_TEST_SUITE_P(nightly_ExperimentalDetectronDetectionOutput_Proposals, ExperimentalDetectronDetectionOutputRandomLayerTest,
+         ::testing::Combine(
+                 ::testing::ValuesIn(inputShapesProposals),
+                 ::testing::Values(0.05f),
+                 ::testing::Values(0.5f),
+                 ::testing::Values(4.135166645050049f),
+                 ::testing::Values(int64_t{81}),
+                 ::testing::Values(int64_t{2000}),
+                 ::testing::Values(size_t{100}),
+                 ::testing::Values(false),
+                 ::testing::ValuesIn(deltas_weights),
+                 ::testing::Values(ov::element::Type_t::f32),
+                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+         ExperimentalDetectronDetectionOutputRandomLayerTest::getTestCaseName);
+
 } // namespace
@@ -77,7 +77,20 @@ protected:
         size_t numSegments, defaultIndex;
         std::tie(inputShapes, indices, segmentIds, numSegments, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // the f32 and bf16 tables are accumulated by the JIT kernel, the rows shorter than the vector by the reference code;
+        // the bf16 table is converted to f32 on the platforms without the bf16 support
+        const auto tablePrecision = inType == ElementType::bf16 && !with_cpu_x86_avx512_core() ? ElementType::f32 : inType;
+        const size_t elPerVec = with_cpu_x86_avx512f() ? 16 : 8;
+        const ov::PartialShape rowShape(std::vector<ov::Dimension>(inputShapes.first.begin() + 1, inputShapes.first.end()));
+        const bool isShortRow = rowShape.is_static() && ov::shape_size(rowShape.to_shape()) < elPerVec;
+        std::string implType = "ref";
+        if ((tablePrecision == ElementType::f32 || tablePrecision == ElementType::bf16) && !isShortRow && with_cpu_x86_avx2()) {
+            implType = with_cpu_x86_avx512f() ? "jit_avx512" : "jit_avx2";
+        }
+        selectedType = makeSelectedTypeStr(implType, tablePrecision);
+        if (inType == ElementType::bf16) {
+            rel_threshold = 1e-2f;
+        }
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -109,6 +122,7 @@ TEST_P(EmbeddingSegmentsSumLayerCPUTest, CompareWithRefs) {
 namespace {
 const std::vector<ElementType> netPrecisions = {
         ElementType::f32,
+        ElementType::bf16,
         ElementType::i32,
         ElementType::u8
 };
@@ -0,0 +1,109 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ie_plugin_config.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The memory of the dynamic edges is planned per input shapes bucket and placed into the shared arena.
+   The input shapes alternate between the buckets, so the test checks that the arena placement of one
+   bucket doesn't corrupt the results of the other ones and the shapes spikes within the bucket.
+
+              Param
+                |
+             Conv1x1
+                |
+               Relu
+              /    \
+         Conv3x3    |
+              \    /
+             Multiply
+                |
+             MaxPool
+                |
+              Result
+*/
+
+class DynamicMemoryBuckets : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape{{-1, 8, -1, -1}, {{1, 8, 16, 16}, {1, 8, 60, 60}, {1, 8, 15, 15}, {2, 8, 64, 64},
+                                                {1, 8, 16, 16}, {1, 8, 33, 33}, {1, 8, 60, 60}, {1, 8, 10, 10}}};
+        init_input_shapes({inputShape});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto conv1 = ngraph::builder::makeConvolution(params[0], ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(conv1);
+        auto conv2 = ngraph::builder::makeConvolution(relu, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 16);
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(relu, conv2);
+        auto pool = ngraph::builder::makePooling(mul, {2, 2}, {0, 0}, {0, 0}, {2, 2}, ngraph::op::RoundingType::FLOOR,
+                                                 ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+
+        function = std::make_shared<ngraph::Function>(std::make_shared<ngraph::opset1::Result>(pool), params,
+                                                      "DynamicMemoryBuckets");
+    }
+
+    /* The upper bound of the memory which the edges would take being allocated individually for the input shape.
+       Each tensor of the model is counted with the channels padded up to the blocked layout (16) and the size
+       rounded up to the planner alignment, the fused nodes and in-place edges only make the real sum smaller. */
+    size_t getIndividualAllocationsSize(const ov::Shape& inputShape) const {
+        constexpr size_t channelsBlock = 16;
+        constexpr size_t alignment = 32;
+
+        auto model = ngraph::clone_function(*function);
+        model->reshape(ov::PartialShape(inputShape));
+
+        size_t total = 0;
+        for (const auto& node : model->get_ordered_ops()) {
+            if (ov::is_type<ngraph::opset1::Constant>(node))
+                continue;
+            auto shape = node->get_output_partial_shape(0).get_shape();
+            shape[1] = (shape[1] + channelsBlock - 1) / channelsBlock * channelsBlock;
+            const auto size = ov::shape_size(shape) * node->get_output_element_type(0).size();
+            total += (size + alignment - 1) / alignment * alignment;
+        }
+        return total;
+    }
+};
+
+TEST_F(DynamicMemoryBuckets, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    const auto peaks = compiledModel.get_property(METRIC_KEY(SHAPE_BUCKETS_PEAK_MEMORY))
+                                    .as<std::map<std::string, uint64_t>>();
+    // the dimensions are rounded up to a power of two, so e.g. {1, 8, 33, 33} and {1, 8, 60, 60} share the bucket
+    ASSERT_EQ(3, peaks.size());
+    ASSERT_NE(peaks.end(), peaks.find("1x8x16x16"));
+    ASSERT_NE(peaks.end(), peaks.find("1x8x64x64"));
+    ASSERT_NE(peaks.end(), peaks.find("2x8x64x64"));
+    ASSERT_LT(peaks.at("1x8x16x16"), peaks.at("1x8x64x64"));
+    ASSERT_LT(peaks.at("1x8x64x64"), peaks.at("2x8x64x64"));
+
+    // the packed arena of the bucket must not exceed the individual allocations for the largest shape of the bucket
+    const std::map<std::string, ov::Shape> largestShapes = {
+        {"1x8x16x16", {1, 8, 16, 16}},
+        {"1x8x64x64", {1, 8, 60, 60}},
+        {"2x8x64x64", {2, 8, 64, 64}},
+    };
+    for (const auto& largest : largestShapes) {
+        ASSERT_GT(peaks.at(largest.first), 0u);
+        ASSERT_LE(peaks.at(largest.first), getIndividualAllocationsSize(largest.second)) << largest.first;
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
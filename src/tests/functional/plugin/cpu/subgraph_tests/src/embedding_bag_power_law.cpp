@@ -0,0 +1,259 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset3.hpp>
+#include <blob_factory.hpp>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The embedding lookup of the recommendation models: the table rows are accessed with the power-law (Zipf)
+   distribution and the bag sizes are skewed, including the empty bags (the bags of EmbeddingBagPackedSum have
+   the same size). The u8/i8 tables are row-wise quantized, the decompression is fused into the EmbeddingBag node,
+   so the table stays compressed in memory.
+
+    Constant(u8/i8)
+          |
+       Convert   Constant
+           \      /
+           Subtract   Constant
+               \      /
+  [Constant(f32)]  Multiply
+               \   /
+                 |    Param(indices)   [Param(offsets/segment ids)]   [Constant]   [Param(per sample weights)]
+                 |       |                        |                       |                  |
+                 EmbeddingBagOffsetsSum / EmbeddingBagPackedSum / EmbeddingSegmentsSum
+                                                |
+                                              Result
+*/
+
+using EmbeddingBagPowerLawParams = std::tuple<
+        std::string,    // EmbeddingBag node type
+        size_t,         // table rows
+        size_t,         // embedding depth
+        size_t,         // bags
+        size_t,         // max bag size
+        element::Type,  // table precision
+        bool>;          // with per sample weights
+
+class EmbeddingBagPowerLaw : public testing::WithParamInterface<EmbeddingBagPowerLawParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagPowerLawParams>& obj) {
+        std::string nodeType;
+        size_t rows, depth, bags, maxBagSize;
+        element::Type tablePrecision;
+        bool withWeights;
+        std::tie(nodeType, rows, depth, bags, maxBagSize, tablePrecision, withWeights) = obj.param;
+
+        std::ostringstream result;
+        result << nodeType << "_";
+        result << "V=" << rows << "_";
+        result << "D=" << depth << "_";
+        result << "bags=" << bags << "_";
+        result << "maxBag=" << maxBagSize << "_";
+        result << "tablePRC=" << tablePrecision << "_";
+        result << "WW=" << withWeights;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        size_t rows, depth, bags, maxBagSize;
+        bool withWeights;
+        std::tie(nodeType, rows, depth, bags, maxBagSize, tablePrecision, withWeights) = GetParam();
+
+        generateIndices(rows, bags, maxBagSize);
+
+        std::shared_ptr<Node> table;
+        if (tablePrecision == element::f32) {
+            table = builder::makeConstant<float>(element::f32, {rows, depth}, {}, true, 1.f, -1.f);
+        } else {
+            const bool isSigned = tablePrecision == element::i8;
+            auto quantized = builder::makeConstant<int>(tablePrecision, {rows, depth}, {}, true, isSigned ? 127 : 255, isSigned ? -128 : 0);
+            auto convert = std::make_shared<opset1::Convert>(quantized, element::f32);
+            auto zeroPoints = builder::makeConstant<float>(element::f32, {rows, 1}, {}, true, isSigned ? 8.f : 136.f, isSigned ? -8.f : 120.f);
+            auto subtract = std::make_shared<opset1::Subtract>(convert, zeroPoints);
+            auto scales = builder::makeConstant<float>(element::f32, {rows, 1}, {}, true, 0.01f, 0.001f);
+            table = std::make_shared<opset1::Multiply>(subtract, scales);
+        }
+
+        const bool isPacked = nodeType == "EmbeddingBagPackedSum";
+        const std::vector<size_t> indicesShape = isPacked ? std::vector<size_t>{bags, maxBagSize} : std::vector<size_t>{indices.size()};
+        auto params = builder::makeParams(element::i32, {indicesShape});
+        params[0]->set_friendly_name("indices");
+        if (nodeType == "EmbeddingBagOffsetsSum") {
+            params.push_back(builder::makeParams(element::i32, {{offsets.size()}})[0]);
+            params.back()->set_friendly_name("offsets");
+        } else if (nodeType == "EmbeddingSegmentsSum") {
+            params.push_back(builder::makeParams(element::i32, {{segmentIds.size()}})[0]);
+            params.back()->set_friendly_name("segment_ids");
+        }
+        if (withWeights) {
+            params.push_back(builder::makeParams(element::f32, {indicesShape})[0]);
+            params.back()->set_friendly_name("weights");
+        }
+        auto defaultIndex = opset1::Constant::create(element::i32, Shape{}, {0});
+
+        std::shared_ptr<Node> embBag;
+        if (nodeType == "EmbeddingBagOffsetsSum") {
+            embBag = withWeights ? std::make_shared<opset3::EmbeddingBagOffsetsSum>(table, params[0], params[1], defaultIndex, params[2])
+                                 : std::make_shared<opset3::EmbeddingBagOffsetsSum>(table, params[0], params[1], defaultIndex);
+        } else if (isPacked) {
+            embBag = withWeights ? std::make_shared<opset3::EmbeddingBagPackedSum>(table, params[0], params[1])
+                                 : std::make_shared<opset3::EmbeddingBagPackedSum>(table, params[0]);
+        } else {
+            auto segmentsNum = opset1::Constant::create(element::i32, Shape{}, {bags});
+            embBag = withWeights ? std::make_shared<opset3::EmbeddingSegmentsSum>(table, params[0], params[1], segmentsNum, defaultIndex, params[2])
+                                 : std::make_shared<opset3::EmbeddingSegmentsSum>(table, params[0], params[1], segmentsNum, defaultIndex);
+        }
+        function = std::make_shared<Function>(embBag, params, "EmbeddingBagPowerLaw");
+    }
+
+    // The bag sizes follow the power law over [0, maxBagSize], the rows follow the Zipf law with the hot rows
+    // scattered over the table.
+    void generateIndices(size_t rows, size_t bags, size_t maxBagSize) {
+        std::mt19937 gen(1);
+
+        std::vector<double> bagSizeWeights(maxBagSize + 1);
+        for (size_t i = 0; i < bagSizeWeights.size(); i++)
+            bagSizeWeights[i] = 1.0 / std::pow(static_cast<double>(i + 1), 1.2);
+        std::discrete_distribution<size_t> bagSizeDist(bagSizeWeights.begin(), bagSizeWeights.end());
+
+        std::vector<double> rowWeights(rows);
+        for (size_t i = 0; i < rows; i++)
+            rowWeights[i] = 1.0 / std::pow(static_cast<double>(i + 1), 1.05);
+        std::discrete_distribution<size_t> rowDist(rowWeights.begin(), rowWeights.end());
+        // the prime multiplier scatters the ranks of the rows over the table
+        const size_t scatter = 1000003;
+
+        offsets.clear();
+        segmentIds.clear();
+        indices.clear();
+        for (size_t b = 0; b < bags; b++) {
+            offsets.push_back(static_cast<int32_t>(indices.size()));
+            const size_t bagSize = nodeType == "EmbeddingBagPackedSum" ? maxBagSize : bagSizeDist(gen);
+            for (size_t i = 0; i < bagSize; i++) {
+                indices.push_back(static_cast<int32_t>(rowDist(gen) * scatter % rows));
+                segmentIds.push_back(static_cast<int32_t>(b));
+            }
+        }
+        // the offset of the last bag has to point into the indices
+        if (indices.size() == static_cast<size_t>(offsets.back())) {
+            indices.push_back(static_cast<int32_t>(rowDist(gen) * scatter % rows));
+            segmentIds.push_back(static_cast<int32_t>(bags - 1));
+        }
+    }
+
+    Blob::Ptr GenerateInput(const InputInfo& info) const override {
+        const std::vector<int32_t>* data = nullptr;
+        if (info.name() == "indices") {
+            data = &indices;
+        } else if (info.name() == "offsets") {
+            data = &offsets;
+        } else if (info.name() == "segment_ids") {
+            data = &segmentIds;
+        } else {
+            return LayerTestsCommon::GenerateInput(info);
+        }
+
+        auto blob = make_blob_with_precision(info.getTensorDesc());
+        blob->allocate();
+        std::copy(data->begin(), data->end(), blob->buffer().as<int32_t*>());
+        return blob;
+    }
+
+    std::string nodeType;
+    element::Type tablePrecision;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> offsets;
+    std::vector<int32_t> segmentIds;
+};
+
+TEST_P(EmbeddingBagPowerLaw, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, nodeType, 1);
+    if (tablePrecision != element::f32) {
+        CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+        CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+    }
+}
+
+// Measures the lookup over the Zipf indices against the reference implementation, the times are reported by the
+// test properties (e.g. --gtest_output=xml).
+TEST_P(EmbeddingBagPowerLaw, DISABLED_Perf) {
+    LoadNetwork();
+    GenerateInputs();
+    // the first inference creates the request and sets the inputs
+    Infer();
+
+    const size_t iterations = 20;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+        inferRequest.Infer();
+    const std::chrono::duration<double, std::micro> inferTime = std::chrono::steady_clock::now() - start;
+
+    // the reference decompresses the whole table on each call, so it's measured on the fewer iterations
+    const size_t refIterations = 3;
+    std::vector<std::pair<element::Type, std::vector<std::uint8_t>>> expected;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < refIterations; i++)
+        expected = CalculateRefs();
+    const std::chrono::duration<double, std::micro> refTime = std::chrono::steady_clock::now() - start;
+
+    Compare(expected, GetOutputs());
+    RecordProperty("us_per_infer", std::to_string(inferTime.count() / iterations));
+    RecordProperty("us_per_reference", std::to_string(refTime.count() / refIterations));
+}
+
+namespace {
+
+const std::vector<element::Type> tablePrecisions = {element::f32, element::u8, element::i8};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagPowerLaw, EmbeddingBagPowerLaw,
+                         ::testing::Combine(::testing::Values("EmbeddingBagOffsetsSum", "EmbeddingSegmentsSum"),
+                                            ::testing::Values(1000),
+                                            ::testing::Values(64, 70),
+                                            ::testing::Values(64),
+                                            ::testing::Values(32),
+                                            ::testing::ValuesIn(tablePrecisions),
+                                            ::testing::Values(true, false)),
+                         EmbeddingBagPowerLaw::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagPowerLaw_Packed, EmbeddingBagPowerLaw,
+                         ::testing::Combine(::testing::Values("EmbeddingBagPackedSum"),
+                                            ::testing::Values(1000),
+                                            ::testing::Values(64, 70),
+                                            ::testing::Values(64),
+                                            ::testing::Values(8),
+                                            ::testing::ValuesIn(tablePrecisions),
+                                            ::testing::Values(true, false)),
+                         EmbeddingBagPowerLaw::getTestCaseName);
+
+// the sizes of the DLRM sparse features, used by the DISABLED_Perf cases
+INSTANTIATE_TEST_SUITE_P(nightly_EmbeddingBagPowerLaw_DLRM, EmbeddingBagPowerLaw,
+                         ::testing::Combine(::testing::Values("EmbeddingBagOffsetsSum"),
+                                            ::testing::Values(100000),
+                                            ::testing::Values(128),
+                                            ::testing::Values(512),
+                                            ::testing::Values(64),
+                                            ::testing::ValuesIn(tablePrecisions),
+                                            ::testing::Values(false)),
+                         EmbeddingBagPowerLaw::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
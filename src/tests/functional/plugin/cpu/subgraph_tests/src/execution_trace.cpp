@@ -0,0 +1,125 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The execution timeline is recorded per stream and exported on demand via ExecutableNetwork::SetConfig,
+   so the exported trace must contain the infer request spans and the spans of the executed nodes.
+
+              Param
+                |
+             Conv3x3
+                |
+               Relu
+                |
+             MaxPool
+                |
+              Result
+*/
+
+class ExecutionTraceTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    const std::string traceFile = "cpu_execution_trace_test.json";
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_TRACE, PluginConfigParams::YES});
+
+        const auto ngPrc = element::f32;
+        auto params = builder::makeParams(ngPrc, {{1, 8, 32, 32}});
+        params[0]->set_friendly_name("ExecutionTraceInput");
+        auto conv = builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        conv->set_friendly_name("ExecutionTraceConv");
+        auto relu = builder::makeActivation(conv, ngPrc, helpers::ActivationTypes::Relu);
+        auto pool = builder::makePooling(relu, {2, 2}, {0, 0}, {0, 0}, {2, 2}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+        pool->set_friendly_name("ExecutionTracePool");
+
+        function = std::make_shared<Function>(std::make_shared<opset1::Result>(pool), params, "ExecutionTrace");
+    }
+
+    void TearDown() override {
+        std::remove(traceFile.c_str());
+    }
+
+    std::string readTrace() const {
+        std::ifstream in(traceFile);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        return buffer.str();
+    }
+};
+
+TEST_F(ExecutionTraceTest, smoke_ExportTrace) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    Infer();
+
+    executableNetwork.SetConfig({{PluginConfigInternalParams::KEY_CPU_TRACE_FILE, traceFile}});
+
+    const auto trace = readTrace();
+
+    ASSERT_NE(std::string::npos, trace.find("\"traceEvents\""));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"Infer\",\"cat\":\"request\""));
+    // the Relu is fused into the Convolution
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"ExecutionTraceConv\",\"cat\":\"node\""));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"ExecutionTracePool\",\"cat\":\"node\""));
+}
+
+TEST_F(ExecutionTraceTest, smoke_ExportRequiresRecording) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.clear();
+    LoadNetwork();
+
+    ASSERT_ANY_THROW(executableNetwork.SetConfig({{PluginConfigInternalParams::KEY_CPU_TRACE_FILE, traceFile}}));
+}
+
+TEST_F(ExecutionTraceTest, smoke_TraceFileIsNotLoadNetworkConfig) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.insert({PluginConfigInternalParams::KEY_CPU_TRACE_FILE, traceFile});
+
+    ASSERT_ANY_THROW(LoadNetwork());
+}
+
+// the export doesn't wait for the running requests, the events which are being recorded are skipped
+TEST_F(ExecutionTraceTest, smoke_ExportDuringInference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < 4; i++)
+        requests.push_back(executableNetwork.CreateInferRequest());
+
+    for (int iteration = 0; iteration < 20; iteration++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        executableNetwork.SetConfig({{PluginConfigInternalParams::KEY_CPU_TRACE_FILE, traceFile}});
+        for (auto& request : requests)
+            request.Wait(InferRequest::WaitMode::RESULT_READY);
+    }
+    executableNetwork.SetConfig({{PluginConfigInternalParams::KEY_CPU_TRACE_FILE, traceFile}});
+
+    const auto trace = readTrace();
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"Infer\",\"cat\":\"request\""));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"ExecutionTracePool\",\"cat\":\"node\""));
+    ASSERT_EQ(trace.size() - 3, trace.rfind("]}"));
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,137 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The decompression subgraph of the weights is fused into FullyConnected, so the weights stay compressed in memory
+   and no Convert or Eltwise nodes are executed. The group-wise decompression splits the reduction dim of the weights
+   into the groups with own scales and zero points.
+
+            Constant(u8/i8)
+                  |
+               Convert   Constant
+                   \      /
+                   Subtract   Constant
+                       \      /
+                       Multiply
+                          |
+    Param          [Reshape]
+        \              /
+              MatMul
+                |
+              Result
+*/
+
+using FCWeightsDecompressionParams = std::tuple<
+        std::vector<size_t>,  // input shape
+        size_t,               // output channels
+        element::Type,        // weights precision
+        bool,                 // transpose weights
+        size_t,               // groups
+        bool>;                // zero points
+
+class FCWeightsDecompression : public testing::WithParamInterface<FCWeightsDecompressionParams>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCWeightsDecompressionParams>& obj) {
+        std::vector<size_t> inputShape;
+        size_t outputChannels, groups;
+        element::Type weightsPrecision;
+        bool transposeB, withZeroPoints;
+        std::tie(inputShape, outputChannels, weightsPrecision, transposeB, groups, withZeroPoints) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "N=" << outputChannels << "_";
+        result << "WP=" << weightsPrecision << "_";
+        result << "transposeB=" << transposeB << "_";
+        result << "groups=" << groups << "_";
+        result << "zp=" << withZeroPoints;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> inputShape;
+        size_t N, groups;
+        element::Type weightsPrecision;
+        bool transposeB, withZeroPoints;
+        std::tie(inputShape, N, weightsPrecision, transposeB, groups, withZeroPoints) = GetParam();
+        const size_t K = inputShape.back();
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+
+        // the group-wise weights are [N, G, K / G], the per channel ones are [N, K] or [K, N]
+        std::vector<size_t> weightsShape, paramsShape;
+        if (groups > 1) {
+            weightsShape = {N, groups, K / groups};
+            paramsShape = {N, groups, 1};
+        } else {
+            weightsShape = transposeB ? std::vector<size_t>{N, K} : std::vector<size_t>{K, N};
+            paramsShape = transposeB ? std::vector<size_t>{N, 1} : std::vector<size_t>{1, N};
+        }
+
+        const bool isSigned = weightsPrecision == element::i8;
+        auto weights = builder::makeConstant<int8_t>(weightsPrecision, weightsShape, {}, true, isSigned ? 7 : 15, isSigned ? -8 : 0);
+        std::shared_ptr<Node> decompressed = std::make_shared<opset1::Convert>(weights, element::f32);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(element::f32, paramsShape, {}, true, 4, 0);
+            decompressed = std::make_shared<opset1::Subtract>(decompressed, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, paramsShape, {}, true, 0.1f, 0.01f);
+        decompressed = std::make_shared<opset1::Multiply>(decompressed, scales);
+        if (groups > 1) {
+            auto shape = opset1::Constant::create(element::i64, Shape{2}, {N, K});
+            decompressed = std::make_shared<opset1::Reshape>(decompressed, shape, false);
+        }
+
+        auto matMul = builder::makeMatMul(params[0], decompressed, false, transposeB);
+        function = std::make_shared<Function>(matMul, params, "FCWeightsDecompression");
+    }
+};
+
+TEST_P(FCWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "FullyConnected", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+const std::vector<element::Type> weightsPrecisions = {element::u8, element::i8};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_PerChannel, FCWeightsDecompression,
+                         ::testing::Combine(::testing::Values(std::vector<size_t>{2, 64}, std::vector<size_t>{2, 5, 48}),
+                                            ::testing::Values(19),
+                                            ::testing::ValuesIn(weightsPrecisions),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(1),
+                                            ::testing::Values(true, false)),
+                         FCWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_Grouped, FCWeightsDecompression,
+                         ::testing::Combine(::testing::Values(std::vector<size_t>{1, 128}, std::vector<size_t>{7, 128}),
+                                            ::testing::Values(35),
+                                            ::testing::ValuesIn(weightsPrecisions),
+                                            ::testing::Values(true),
+                                            ::testing::Values(4),
+                                            ::testing::Values(true, false)),
+                         FCWeightsDecompression::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,70 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The memory of each stream graph is bound to the NUMA node of the stream, so the resident pages of the graph
+   are expected to be mostly local. The only memory which may be remote is the zero-copied input blob of the test,
+   which is allocated by the main thread. The test is skipped on the single NUMA node hosts and if the placement
+   is unknown without the NUMA aware threading, then the metric is empty.
+
+              Param
+                |
+             Conv3x3
+                |
+               Relu
+                |
+             MaxPool
+                |
+              Result
+*/
+
+class NumaMemoryPlacementTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"});
+        configuration.insert({CONFIG_KEY(CPU_BIND_THREAD), CONFIG_VALUE(NUMA)});
+
+        const auto ngPrc = element::f32;
+        auto params = builder::makeParams(ngPrc, {{1, 8, 32, 32}});
+        auto conv = builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 32);
+        auto relu = builder::makeActivation(conv, ngPrc, helpers::ActivationTypes::Relu);
+        auto pool = builder::makePooling(relu, {2, 2}, {0, 0}, {0, 0}, {2, 2}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+
+        function = std::make_shared<Function>(std::make_shared<opset1::Result>(pool), params, "NumaMemoryPlacement");
+    }
+};
+
+TEST_F(NumaMemoryPlacementTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (InferenceEngine::getAvailableNUMANodes().size() < 2)
+        GTEST_SKIP() << "The host has a single NUMA node";
+
+    Run();
+
+    const auto placements = executableNetwork.GetMetric(METRIC_KEY(NUMA_MEMORY_PLACEMENT))
+                                             .as<std::map<std::string, std::vector<uint64_t>>>();
+    if (placements.empty())
+        GTEST_SKIP() << "The NUMA placement of the streams is unknown";
+    for (const auto& stream : placements) {
+        const auto& values = stream.second;
+        ASSERT_EQ(3, values.size()) << stream.first;
+        // the graphs are created for all the streams on the network compilation, so every stream has local memory
+        ASSERT_GT(values[1], 0u) << stream.first;
+        ASSERT_GE(values[1], values[2]) << stream.first;
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
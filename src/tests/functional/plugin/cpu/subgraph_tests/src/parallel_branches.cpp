@@ -0,0 +1,77 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* Inception-like block executed with independent branches running concurrently.
+   The branches reuse the memory of each other, so the test also checks that
+   the memory reuse dependencies are respected by the scheduler.
+
+                  Param
+          /     /       \      \
+      Conv1x1 Conv1x1  Conv1x1  MaxPool
+         |      |        |        |
+       Relu   Conv3x3  Conv5x5  Conv1x1
+          \      \       /       /
+                   Concat
+                     |
+                   Result
+*/
+
+class ParallelBranchesTest : public testing::WithParamInterface<std::string>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "ParallelBranches=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES, GetParam()});
+
+        const auto ngPrc = element::f32;
+        auto params = builder::makeParams(ngPrc, {{1, 16, 20, 20}});
+
+        auto makeConv = [&](const Output<Node>& in, size_t kernel, size_t outChannels) {
+            const std::ptrdiff_t pad = kernel / 2;
+            return builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                            op::PadType::EXPLICIT, outChannels);
+        };
+
+        auto branch1 = builder::makeActivation(makeConv(params[0], 1, 8), ngPrc, helpers::ActivationTypes::Relu);
+        auto branch2 = makeConv(makeConv(params[0], 1, 8), 3, 8);
+        auto branch3 = makeConv(makeConv(params[0], 1, 4), 5, 8);
+        auto pool = builder::makePooling(params[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+        auto branch4 = makeConv(pool, 1, 8);
+
+        auto concat = builder::makeConcat({branch1, branch2, branch3, branch4}, 1);
+        function = std::make_shared<Function>(std::make_shared<opset1::Result>(concat), params, "ParallelBranches");
+    }
+};
+
+TEST_P(ParallelBranchesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelBranches, ParallelBranchesTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         ParallelBranchesTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,72 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The latency histograms are collected for every executed node, so the percentiles must be reported
+   for the same nodes as the perf counters and must be ordered. The maximum is the upper bound of
+   the histogram bucket, so it can't be less than the average latency.
+
+              Param
+                |
+             Conv3x3
+                |
+               Relu
+                |
+             MaxPool
+                |
+              Result
+*/
+
+class PerfHistogramsTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PERF_COUNT_HISTOGRAMS, PluginConfigParams::YES});
+
+        const auto ngPrc = element::f32;
+        auto params = builder::makeParams(ngPrc, {{1, 8, 32, 32}});
+        auto conv = builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto relu = builder::makeActivation(conv, ngPrc, helpers::ActivationTypes::Relu);
+        auto pool = builder::makePooling(relu, {2, 2}, {0, 0}, {0, 0}, {2, 2}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+
+        function = std::make_shared<Function>(std::make_shared<opset1::Result>(pool), params, "PerfHistograms");
+    }
+};
+
+TEST_F(PerfHistogramsTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    for (size_t i = 0; i < 10; i++)
+        Infer();
+
+    const auto perfCounts = inferRequest.GetPerformanceCounts();
+    const auto percentiles = executableNetwork.GetMetric(METRIC_KEY(NODE_LATENCY_PERCENTILES))
+                                              .as<std::map<std::string, std::vector<double>>>();
+    ASSERT_FALSE(percentiles.empty());
+    for (const auto& node : percentiles) {
+        const auto& values = node.second;
+        ASSERT_EQ(4, values.size()) << node.first;
+        ASSERT_TRUE(std::is_sorted(values.begin(), values.end())) << node.first;
+
+        const auto perfCount = perfCounts.find(node.first);
+        ASSERT_NE(perfCounts.end(), perfCount) << node.first;
+        ASSERT_GE(values.back(), perfCount->second.realTime_uSec) << node.first;
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
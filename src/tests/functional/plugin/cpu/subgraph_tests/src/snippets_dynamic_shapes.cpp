@@ -0,0 +1,61 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The eltwise chain is tokenized to the single Subgraph with dynamic shapes. The kernel is generated
+   once per broadcasting pattern of the last dims, so the shapes alternate between the patterns to check
+   that the cached kernels get the proper work amounts and offsets in the call args.
+
+            Param0   Param1
+               \      /
+                 Add
+                  |   Param0
+                  |   /
+                Multiply
+                  |
+                 Relu
+                  |
+                Result
+*/
+
+class SnippetsDynamicShapes : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<InputShape> inputShapes {
+            {{-1, 3, -1, -1}, {{1, 3, 16, 16}, {2, 3, 7, 9}, {1, 3, 16, 1}, {1, 3, 4, 9}, {1, 3, 5, 33}, {1, 3, 16, 16}}},
+            {{-1, 3, 1, -1},  {{1, 3, 1, 16},  {2, 3, 1, 9}, {1, 3, 1, 1},  {1, 3, 1, 1}, {1, 3, 1, 33}, {1, 3, 1, 16}}}
+        };
+        init_input_shapes(inputShapes);
+
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(add, params[0]);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(mul);
+
+        function = std::make_shared<ngraph::Function>(std::make_shared<ngraph::opset1::Result>(relu), params,
+                                                      "SnippetsDynamicShapes");
+    }
+};
+
+TEST_F(SnippetsDynamicShapes, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,97 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset8.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The snippet is executed in fp32, but loads the low precision inputs and stores the low precision outputs directly
+   converting them in registers, so no precision conversion Reorder is expected at the Subgraph boundaries.
+
+            Param0   Param1
+               \      /
+                 Add
+                  |   Param0
+                  |   /
+                Multiply
+                  |
+                 Relu
+                  |
+                Result
+*/
+
+using SnippetsLowPrecisionIOParams = std::tuple<
+        Precision,   // input precision
+        Precision>;  // output precision
+
+class SnippetsLowPrecisionIO : public testing::WithParamInterface<SnippetsLowPrecisionIOParams>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsLowPrecisionIOParams>& obj) {
+        Precision inputPrecision, outputPrecision;
+        std::tie(inputPrecision, outputPrecision) = obj.param;
+        return "inPrc=" + std::string(inputPrecision.name()) + "_outPrc=" + outputPrecision.name();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::tie(inPrc, outPrc) = GetParam();
+
+        auto type = element::f32;
+        auto params = builder::makeParams(type, {{1, 3, 16, 19}, {1, 3, 1, 19}});
+        auto add = std::make_shared<opset8::Add>(params[0], params[1]);
+        auto mul = std::make_shared<opset8::Multiply>(add, params[0]);
+        auto relu = std::make_shared<opset8::Relu>(mul);
+
+        function = std::make_shared<Function>(relu, params, "SnippetsLowPrecisionIO");
+    }
+
+    // (7 + 7) * 7 still fits i8, so the integer outputs are exact and not saturated
+    Blob::Ptr GenerateInput(const InputInfo& info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 7, 0);
+    }
+};
+
+TEST_P(SnippetsLowPrecisionIO, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the bf16 data is converted in registers only on avx512_core, otherwise the Reorders are expected
+    if ((inPrc == Precision::BF16 || outPrc == Precision::BF16) && !InferenceEngine::with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    Run();
+
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Subgraph", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Reorder", 0);
+}
+
+namespace {
+
+const std::vector<Precision> integerPrecisions = {Precision::U8, Precision::I8};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LowPrecisionInputs, SnippetsLowPrecisionIO,
+                         ::testing::Combine(::testing::ValuesIn(integerPrecisions),
+                                            ::testing::Values(Precision::FP32)),
+                         SnippetsLowPrecisionIO::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LowPrecisionOutputs, SnippetsLowPrecisionIO,
+                         ::testing::Combine(::testing::ValuesIn(integerPrecisions),
+                                            ::testing::ValuesIn(integerPrecisions)),
+                         SnippetsLowPrecisionIO::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_BF16, SnippetsLowPrecisionIO,
+                         ::testing::Values(std::make_tuple(Precision::BF16, Precision::FP32),
+                                           std::make_tuple(Precision::FP32, Precision::BF16),
+                                           std::make_tuple(Precision::BF16, Precision::BF16)),
+                         SnippetsLowPrecisionIO::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
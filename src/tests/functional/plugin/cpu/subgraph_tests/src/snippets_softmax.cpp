@@ -0,0 +1,209 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset8.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The Softmax over the innermost axis is decomposed into the reductions and tokenized together with
+   the eltwise producer and consumer, so the whole chain is executed by the single Subgraph.
+   The innermost dims are chosen to have both vector and scalar tails.
+
+            Param0   Param1
+               \      /
+                 Add
+                  |
+               Softmax
+                  |
+                 Relu
+                  |
+                Result
+*/
+
+using SnippetsSoftmaxParams = std::vector<size_t>;
+
+class SnippetsSoftmax : public testing::WithParamInterface<SnippetsSoftmaxParams>,
+                        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsSoftmaxParams>& obj) {
+        return "IS=" + CommonTestUtils::vec2str(obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const auto& shape = GetParam();
+        auto type = element::f32;
+        auto params = builder::makeParams(type, {shape, shape});
+        auto add = std::make_shared<opset8::Add>(params[0], params[1]);
+        auto softmax = std::make_shared<opset8::Softmax>(add, -1);
+        auto relu = std::make_shared<opset8::Relu>(softmax);
+
+        function = std::make_shared<Function>(relu, params, "SnippetsSoftmax");
+    }
+};
+
+TEST_P(SnippetsSoftmax, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Subgraph", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Softmax", 0);
+}
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 3, 16, 19},
+        {2, 5, 35},
+        {1, 64, 3}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets, SnippetsSoftmax,
+                         ::testing::ValuesIn(inputShapes),
+                         SnippetsSoftmax::getTestCaseName);
+
+/* The reduced value is the output of the Subgraph, so it's stored once per row next to the full row output.
+
+            Param0   Param1
+               \      /
+                 Add
+                /   \
+       ReduceX(-1)   Relu
+             |        |
+           Result   Result
+*/
+
+using SnippetsReduceParams = std::tuple<
+        helpers::ReductionType,  // reduction type
+        std::vector<size_t>>;    // input shape
+
+class SnippetsReduce : public testing::WithParamInterface<SnippetsReduceParams>,
+                       virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsReduceParams>& obj) {
+        helpers::ReductionType reductionType;
+        std::vector<size_t> inputShape;
+        std::tie(reductionType, inputShape) = obj.param;
+
+        std::ostringstream result;
+        result << "type=" << reductionType << "_";
+        result << "IS=" << CommonTestUtils::vec2str(inputShape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        helpers::ReductionType reductionType;
+        std::vector<size_t> shape;
+        std::tie(reductionType, shape) = GetParam();
+        auto type = element::f32;
+        auto params = builder::makeParams(type, {shape, shape});
+        auto add = std::make_shared<opset8::Add>(params[0], params[1]);
+        auto axes = opset8::Constant::create(element::i64, Shape{1}, {shape.size() - 1});
+        auto reduce = builder::makeReduce(add, axes, true, reductionType);
+        auto relu = std::make_shared<opset8::Relu>(add);
+
+        function = std::make_shared<Function>(OutputVector{reduce, relu}, params, "SnippetsReduce");
+    }
+};
+
+TEST_P(SnippetsReduce, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Subgraph", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Reduce", 0);
+}
+
+const std::vector<helpers::ReductionType> reductionTypes = {
+        helpers::ReductionType::Sum,
+        helpers::ReductionType::Max,
+        helpers::ReductionType::Mean
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets, SnippetsReduce,
+                         ::testing::Combine(::testing::ValuesIn(reductionTypes),
+                                            ::testing::ValuesIn(inputShapes)),
+                         SnippetsReduce::getTestCaseName);
+
+/* The layer normalization built from the reductions over the innermost axis. The square is the Multiply,
+   so the pattern isn't fused into MVN and the whole normalization is executed by the single Subgraph.
+
+                Param
+               /     \
+              | ReduceMean(-1)
+               \     /
+              Subtract
+              /  |   \
+             | Multiply
+             |   |
+             | ReduceMean(-1)
+             |   |
+             | Add(eps)
+             |   |
+             | Sqrt
+              \  /
+             Divide
+               |
+            Multiply(gamma)
+               |
+             Add(beta)
+               |
+             Result
+*/
+
+class SnippetsLayerNorm : public testing::WithParamInterface<std::vector<size_t>>,
+                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<std::vector<size_t>>& obj) {
+        return "IS=" + CommonTestUtils::vec2str(obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const auto& shape = GetParam();
+        auto type = element::f32;
+        auto params = builder::makeParams(type, {shape});
+        auto axes = opset8::Constant::create(element::i64, Shape{1}, {shape.size() - 1});
+        auto mean = std::make_shared<opset8::ReduceMean>(params[0], axes, true);
+        auto centered = std::make_shared<opset8::Subtract>(params[0], mean);
+        auto squared = std::make_shared<opset8::Multiply>(centered, centered);
+        auto variance = std::make_shared<opset8::ReduceMean>(squared, axes, true);
+        auto eps = opset8::Constant::create(type, Shape{1}, {1e-5f});
+        auto stddev = std::make_shared<opset8::Sqrt>(std::make_shared<opset8::Add>(variance, eps));
+        auto normalized = std::make_shared<opset8::Divide>(centered, stddev);
+        auto gamma = opset8::Constant::create(type, Shape{1}, {0.5f});
+        auto beta = opset8::Constant::create(type, Shape{1}, {2.f});
+        auto result = std::make_shared<opset8::Add>(std::make_shared<opset8::Multiply>(normalized, gamma), beta);
+
+        function = std::make_shared<Function>(result, params, "SnippetsLayerNorm");
+    }
+};
+
+TEST_P(SnippetsLayerNorm, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Subgraph", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "Reduce", 0);
+    CPUTestUtils::CheckNumberOfNodesWithType(executableNetwork, "MVN", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets, SnippetsLayerNorm,
+                         ::testing::ValuesIn(inputShapes),
+                         SnippetsLayerNorm::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
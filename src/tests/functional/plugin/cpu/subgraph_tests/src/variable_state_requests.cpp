@@ -0,0 +1,154 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "blob_factory.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The state value stays in the graph memory between the inferences, so the test interleaves
+   the inferences of two requests sharing the same graph and checks both the outputs and the states.
+
+          Param    ReadValue
+             \     /      \
+               Add      Multiply(2)
+                |          |
+              Assign     Result
+*/
+
+class VariableStateRequestsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto ngPrc = element::f32;
+        const Shape shape{1, 64};
+        auto params = builder::makeParams(ngPrc, {shape});
+
+        auto variable = std::make_shared<Variable>(VariableInfo{PartialShape(shape), ngPrc, "accumulator"});
+        auto init = builder::makeConstant<float>(ngPrc, shape, {}, false);
+        auto readValue = std::make_shared<opset6::ReadValue>(init, variable);
+        auto add = std::make_shared<opset1::Add>(readValue, params[0]);
+        auto assign = std::make_shared<opset6::Assign>(add, variable);
+        auto mul = std::make_shared<opset1::Multiply>(readValue, builder::makeConstant<float>(ngPrc, {1}, {2.f}));
+
+        auto function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(mul)},
+                                                   SinkVector{assign}, params, "VariableStateRequests");
+        auto ie = PluginCache::get().ie(CommonTestUtils::DEVICE_CPU);
+        execNet = ie->LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU);
+        inputName = execNet.GetInputsInfo().begin()->first;
+        outputName = execNet.GetOutputsInfo().begin()->first;
+    }
+
+    InferRequest createRequest(float inputValue) {
+        auto request = execNet.CreateInferRequest();
+        auto blob = request.GetBlob(inputName);
+        auto data = blob->buffer().as<float*>();
+        std::fill(data, data + blob->size(), inputValue);
+        return request;
+    }
+
+    static void setState(InferRequest& request, float value) {
+        auto state = request.QueryState().front();
+        auto newState = make_blob_with_precision(state.GetState()->getTensorDesc());
+        newState->allocate();
+        std::fill(newState->buffer().as<float*>(), newState->buffer().as<float*>() + newState->size(), value);
+        state.SetState(newState);
+    }
+
+    static void check(const Blob::CPtr& blob, float expected) {
+        auto data = blob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            ASSERT_FLOAT_EQ(expected, data[i]);
+        }
+    }
+
+    ExecutableNetwork execNet;
+    std::string inputName;
+    std::string outputName;
+};
+
+TEST_F(VariableStateRequestsTest, InterleavedRequests) {
+    auto request1 = createRequest(1.f);
+    auto request2 = createRequest(10.f);
+
+    for (int i = 1; i <= 3; i++) {
+        request1.Infer();
+        check(request1.GetBlob(outputName), 2.f * (i - 1));
+        request2.Infer();
+        request2.Infer();
+        check(request2.GetBlob(outputName), 10.f * 2.f * (2 * i - 1));
+    }
+    check(request1.QueryState().front().GetState(), 3.f);
+    check(request2.QueryState().front().GetState(), 60.f);
+
+    // the state of the request is kept in the graph between the inferences of the same request
+    request1.Infer();
+    request1.Infer();
+    check(request1.GetBlob(outputName), 2.f * 4.f);
+    check(request1.QueryState().front().GetState(), 5.f);
+
+    request2.QueryState().front().Reset();
+    request2.Infer();
+    check(request2.GetBlob(outputName), 0.f);
+    check(request2.QueryState().front().GetState(), 10.f);
+
+    request1.Infer();
+    check(request1.GetBlob(outputName), 2.f * 5.f);
+    check(request1.QueryState().front().GetState(), 6.f);
+}
+
+TEST_F(VariableStateRequestsTest, SetStateBetweenInferences) {
+    auto request = createRequest(1.f);
+    request.Infer();
+    request.Infer();
+    check(request.QueryState().front().GetState(), 2.f);
+
+    setState(request, 100.f);
+
+    request.Infer();
+    check(request.GetBlob(outputName), 200.f);
+    check(request.QueryState().front().GetState(), 101.f);
+}
+
+// SetState and GetState of one request while the graph holds the state of the other one
+TEST_F(VariableStateRequestsTest, InterleavedSetGetState) {
+    auto request1 = createRequest(1.f);
+    auto request2 = createRequest(10.f);
+
+    request1.Infer();
+    setState(request2, 5.f);
+    check(request1.QueryState().front().GetState(), 1.f);
+    check(request2.QueryState().front().GetState(), 5.f);
+
+    // the state of request1 is moved out of the graph and the value set by the user is used for request2
+    request2.Infer();
+    check(request2.GetBlob(outputName), 2.f * 5.f);
+    check(request2.QueryState().front().GetState(), 15.f);
+    check(request1.QueryState().front().GetState(), 1.f);
+
+    // the value set for the request which is not in the graph replaces the saved one
+    setState(request1, 20.f);
+    request1.Infer();
+    check(request1.GetBlob(outputName), 2.f * 20.f);
+    check(request1.QueryState().front().GetState(), 21.f);
+
+    // the value set for the request which is in the graph replaces the one in the graph
+    setState(request1, 7.f);
+    check(request1.QueryState().front().GetState(), 7.f);
+    request2.Infer();
+    check(request2.GetBlob(outputName), 2.f * 15.f);
+    check(request2.QueryState().front().GetState(), 25.f);
+    check(request1.QueryState().front().GetState(), 7.f);
+
+    request1.Infer();
+    check(request1.GetBlob(outputName), 2.f * 7.f);
+    check(request1.QueryState().front().GetState(), 8.f);
+    check(request2.QueryState().front().GetState(), 25.f);
+}
+
+} // namespace SubgraphTestsDefinitions
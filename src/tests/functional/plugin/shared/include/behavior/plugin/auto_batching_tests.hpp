@@ -158,6 +158,203 @@ public:
     }
 };
 
+// The adaptive batch collection executes the partially collected batches with the lower-batch variants of the network,
+// every executed request has to be accounted in the histogram of the executed batches.
+class AutoBatching_Test_Adaptive : public CommonTestUtils::TestsCommon,
+                                   public testing::WithParamInterface<AutoBatchTwoNetsParams> {
+    void SetUp() override {
+        std::tie(device_name, use_get_blob, num_streams, num_requests, num_batch) = this->GetParam();
+        fn_ptr = ngraph::builder::subgraph::makeSingleConv();
+    };
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchTwoNetsParams> &obj) {
+        return "Adaptive_" + AutoBatching_Test::getTestCaseName(obj);
+    }
+
+protected:
+    std::string device_name;
+    bool use_get_blob;
+    size_t num_streams;
+    size_t num_requests;
+    size_t num_batch;
+    std::shared_ptr<ngraph::Function> fn_ptr;
+
+    void TestAdaptiveAutoBatch() {
+        CNNNetwork net(fn_ptr);
+        auto inputs = net.getInputsInfo();
+        for (auto n : inputs) {
+            n.second->setPrecision(Precision::FP32);
+        }
+        auto output = net.getOutputsInfo().begin();
+
+        auto ie = InferenceEngine::Core();
+        std::map<std::string, std::string> config;
+        if (device_name.find("CPU") != std::string::npos)
+            config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
+        config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1);
+        config[CONFIG_KEY(AUTO_BATCH_ADAPTIVE)] = CONFIG_VALUE(YES);
+        auto exec_net = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
+                                            device_name + "(" + std::to_string(num_batch) + ")",
+                                       config);
+
+        std::vector<InferRequest> irs;
+        std::vector<std::vector<uint8_t>> ref;
+        for (size_t j = 0; j < num_requests; j++) {
+            auto inf_req = exec_net.CreateInferRequest();
+            irs.push_back(inf_req);
+
+            std::vector<std::vector<uint8_t>> inData;
+            for (auto n : inputs) {
+                auto blob = FuncTestUtils::createAndFillBlob(n.second->getTensorDesc(), 10, static_cast<int32_t>(j));
+                if (use_get_blob)
+                    memcpy(reinterpret_cast<void *>(inf_req.GetBlob(n.first)->buffer().as<uint8_t*>()),
+                           reinterpret_cast<const void *>(blob->cbuffer().as<uint8_t*>()), blob->byteSize());
+                else
+                    inf_req.SetBlob(n.first, blob);
+
+                const auto inBlob = inf_req.GetBlob(n.first);
+                const auto inBlobBuf = inBlob->cbuffer().as<uint8_t *>();
+                inData.push_back(std::vector<uint8_t>(inBlobBuf, inBlobBuf + inBlob->byteSize()));
+            }
+            ref.push_back(ngraph::helpers::interpreterFunction(fn_ptr, {inData}).front().second);
+        }
+
+        for (auto ir : irs) {
+            ir.StartAsync();
+        }
+        for (auto ir : irs) {
+            ir.Wait(InferRequest::RESULT_READY);
+        }
+
+        const auto outElementsCount = ngraph::shape_size(fn_ptr->get_output_shape(0));
+        auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
+        for (size_t i = 0; i < irs.size(); ++i) {
+            ASSERT_EQ(outElementsCount, irs[i].GetBlob(output->first)->size());
+            FuncTestUtils::compareRawBuffers(irs[i].GetBlob(output->first)->buffer().as<float *>(),
+                                             reinterpret_cast<const float *>(ref[i].data()), outElementsCount,
+                                             outElementsCount,
+                                             thr);
+        }
+
+        auto histogram = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_HISTOGRAM)).as<std::map<unsigned int, uint64_t>>();
+        ASSERT_FALSE(histogram.empty());
+        uint64_t executed = 0;
+        for (const auto& h : histogram) {
+            ASSERT_LE(h.first, num_batch);
+            executed += h.first * h.second;
+        }
+        ASSERT_EQ(num_requests, executed);
+    }
+};
+
+using AutoBatchNotBatchableParams = std::tuple<
+        std::string,  // device name
+        size_t,       // number of requests
+        size_t>;      // batch size
+
+// The blobs which can't be shared with the batched request (here the ones with pre-processing) make the request
+// executed by its batch1 request, such executions bypass the batch collection and are not in the histogram.
+class AutoBatching_Test_NotBatchableBlobs : public CommonTestUtils::TestsCommon,
+                                            public testing::WithParamInterface<AutoBatchNotBatchableParams> {
+    void SetUp() override {
+        std::tie(device_name, num_requests, num_batch) = this->GetParam();
+        fn_ptr = ngraph::builder::subgraph::makeSingleConv();
+    };
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchNotBatchableParams> &obj) {
+        size_t requests, batch;
+        std::string device_name;
+        std::tie(device_name, requests, batch) = obj.param;
+        return "NotBatchable_" + device_name + "_batch_size_" + std::to_string(batch) +
+               "_num_req_" + std::to_string(requests);
+    }
+
+protected:
+    std::string device_name;
+    size_t num_requests;
+    size_t num_batch;
+    std::shared_ptr<ngraph::Function> fn_ptr;
+    ExecutableNetwork exec_net;
+    std::string input_name;
+    std::string output_name;
+
+    void LoadNetwork() {
+        CNNNetwork net(fn_ptr);
+        auto inputs = net.getInputsInfo();
+        inputs.begin()->second->setPrecision(Precision::FP32);
+        input_name = inputs.begin()->first;
+        output_name = net.getOutputsInfo().begin()->first;
+
+        auto ie = InferenceEngine::Core();
+        std::map<std::string, std::string> config;
+        config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1);
+        exec_net = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
+                                       device_name + "(" + std::to_string(num_batch) + ")",
+                                  config);
+    }
+
+    // the resize to the same size makes the blob pre-processed, the data stays the same
+    Blob::Ptr SetInput(InferRequest& inf_req, size_t idx, bool with_pre_processing) {
+        auto desc = exec_net.GetInputsInfo().begin()->second->getTensorDesc();
+        auto blob = FuncTestUtils::createAndFillBlob(desc, 10, static_cast<int32_t>(idx));
+        if (with_pre_processing) {
+            PreProcessInfo info;
+            info.setResizeAlgorithm(ResizeAlgorithm::RESIZE_BILINEAR);
+            inf_req.SetBlob(input_name, blob, info);
+        } else {
+            inf_req.SetBlob(input_name, blob, PreProcessInfo());
+        }
+        return blob;
+    }
+
+    void CompareWithReference(InferRequest& inf_req, const Blob::Ptr& input) {
+        const auto inBuf = input->cbuffer().as<const uint8_t *>();
+        const auto ref = ngraph::helpers::interpreterFunction(
+                fn_ptr, {std::vector<uint8_t>(inBuf, inBuf + input->byteSize())}).front().second;
+        const auto outElementsCount = ngraph::shape_size(fn_ptr->get_output_shape(0));
+        auto output = inf_req.GetBlob(output_name);
+        ASSERT_EQ(outElementsCount, output->size());
+        FuncTestUtils::compareRawBuffers(output->buffer().as<float *>(),
+                                         reinterpret_cast<const float *>(ref.data()), outElementsCount,
+                                         outElementsCount,
+                                         FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32));
+    }
+
+    uint64_t GetExecutedInBatches() {
+        auto histogram = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_HISTOGRAM)).as<std::map<unsigned int, uint64_t>>();
+        uint64_t executed = 0;
+        for (const auto& h : histogram)
+            executed += h.first * h.second;
+        return executed;
+    }
+
+    // every even request gets the pre-processed (not batchable) blob
+    void TestNotBatchableBlobs(bool all_not_batchable) {
+        LoadNetwork();
+        std::vector<InferRequest> irs;
+        std::vector<Blob::Ptr> inputs;
+        size_t batchable = 0;
+        for (size_t j = 0; j < num_requests; j++) {
+            irs.push_back(exec_net.CreateInferRequest());
+            const bool with_pre_processing = all_not_batchable || j % 2 == 0;
+            batchable += with_pre_processing ? 0 : 1;
+            inputs.push_back(SetInput(irs.back(), j, with_pre_processing));
+        }
+
+        for (auto ir : irs) {
+            ir.StartAsync();
+        }
+        for (auto ir : irs) {
+            ir.Wait(InferRequest::RESULT_READY);
+        }
+
+        for (size_t i = 0; i < irs.size(); ++i) {
+            CompareWithReference(irs[i], inputs[i]);
+        }
+        ASSERT_EQ(batchable, GetExecutedInBatches());
+    }
+};
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
@@ -166,4 +363,33 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
+TEST_P(AutoBatching_Test_Adaptive, compareAutoBatchingToSingleBatch) {
+    TestAdaptiveAutoBatch();
+}
+
+TEST_P(AutoBatching_Test_NotBatchableBlobs, notBatchableBlobsAreExecutedWithBatch1) {
+    TestNotBatchableBlobs(true);
+}
+
+TEST_P(AutoBatching_Test_NotBatchableBlobs, mixedBlobsAreExecutedWithBatchAndBatch1) {
+    TestNotBatchableBlobs(false);
+}
+
+TEST_P(AutoBatching_Test_NotBatchableBlobs, blobWithoutPreProcessingIsBatchedAgain) {
+    LoadNetwork();
+    auto inf_req = exec_net.CreateInferRequest();
+
+    auto input = SetInput(inf_req, 0, true);
+    inf_req.Infer();
+    CompareWithReference(inf_req, input);
+    ASSERT_EQ(0, GetExecutedInBatches());
+
+    // the pre-processing of the previous blob is not reused
+    input = SetInput(inf_req, 1, false);
+    ASSERT_EQ(input, inf_req.GetBlob(input_name));
+    inf_req.Infer();
+    CompareWithReference(inf_req, input);
+    ASSERT_EQ(1, GetExecutedInBatches());
+}
+
 }  // namespace AutoBatchingTests
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <map>
 #include <tuple>
 #include <string>
 #include <vector>
@@ -37,6 +38,11 @@ struct HeteroSyntheticTest : public testing::WithParamInterface<HeteroSyntheticT
     void SetUp() override;
     void TearDown() override;
     std::string SetUpAffinity();
+    // runs the cost model partitioning with the costs which make every node cheap on the pointed device
+    // and checks the device of every node in the dumped partition
+    void CheckCostModelPartitioning(const std::string& objective,
+                                    const std::map<std::string, std::string>& cheapDevices,
+                                    const std::map<std::string, std::string>& expectedDevices);
     static std::string getTestCaseName(const ::testing::TestParamInfo<HeteroSyntheticTestParameters>& obj);
     static std::vector<FunctionParameter> _singleMajorNodeFunctions;
     static std::vector<FunctionParameter> _randomMajorNodeFunctions;
@@ -14,6 +14,10 @@ TEST_P(ExperimentalDetectronDetectionOutputLayerTest, ExperimentalDetectronDetec
     run();
 }
 
+TEST_P(ExperimentalDetectronDetectionOutputRandomLayerTest, ExperimentalDetectronDetectionOutputLayerTests) {
+    run();
+}
+
 } // namespace subgraph
 } // namespace test
 } // namespace ov
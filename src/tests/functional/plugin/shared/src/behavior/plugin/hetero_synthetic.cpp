@@ -8,7 +8,10 @@
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
+#include <fstream>
+#include <cstdio>
 #include "ie_algorithm.hpp"
+#include <hetero/hetero_plugin_config.hpp>
 namespace HeteroTests {
 
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
@@ -184,4 +187,145 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackPipelined) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE)] = CONFIG_VALUE(YES);
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+
+    // the requests share the subnetwork requests, so the concurrently executed requests must not affect each other:
+    // every request gets own inputs and is compared with own reference
+    const std::size_t requestsNum = 4;
+    const auto& inputsInfo = executableNetwork.GetInputsInfo();
+    const auto& params = function->get_parameters();
+    std::vector<InferenceEngine::InferRequest> requests;
+    std::vector<std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>>> references;
+    for (std::size_t i = 0; i < requestsNum; ++i) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        inputs.clear();
+        for (auto&& param : params) {
+            const auto& info = inputsInfo.at(param->get_friendly_name());
+            inputs.push_back(FuncTestUtils::createAndFillBlob(info->getTensorDesc(), 10, 0, 1, static_cast<int>(i + 2)));
+            requests.back().SetBlob(param->get_friendly_name(), inputs.back());
+        }
+        references.push_back(CalculateRefs());
+    }
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (std::size_t i = 0; i < requestsNum; ++i) {
+        requests[i].Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+        std::size_t outputIdx = 0;
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            Compare(references[i].at(outputIdx++), requests[i].GetBlob(output.first));
+        }
+    }
+}
+
+void HeteroSyntheticTest::CheckCostModelPartitioning(const std::string& objective,
+                                                     const std::map<std::string, std::string>& cheapDevices,
+                                                     const std::map<std::string, std::string>& expectedDevices) {
+    auto& pluginParameters = std::get<Plugin>(GetParam());
+    const std::string costsPath = "hetero_synthetic_costs_" + function->get_friendly_name() + ".txt";
+    {
+        std::ofstream costs{costsPath};
+        costs << "transfer 0\n";
+        for (auto&& cheapDevice : cheapDevices) {
+            for (auto&& pluginParameter : pluginParameters) {
+                costs << pluginParameter._name << " " << cheapDevice.first << " "
+                      << (pluginParameter._name == cheapDevice.second ? 1 : 10) << "\n";
+            }
+        }
+    }
+    configuration[HETERO_CONFIG_KEY(PARTITIONING)] = objective;
+    configuration[HETERO_CONFIG_KEY(NODE_COSTS)] = costsPath;
+    configuration[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = CONFIG_VALUE(YES);
+    Run();
+    std::remove(costsPath.c_str());
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+
+    const auto networkName = cnnNetwork.getName();
+    const std::string dotPath = "hetero_partition_" + networkName + ".dot";
+    std::ifstream dot{dotPath};
+    ASSERT_TRUE(dot.is_open());
+    const std::string content{std::istreambuf_iterator<char>{dot}, std::istreambuf_iterator<char>{}};
+    dot.close();
+    for (auto&& dumpName : {dotPath, "hetero_affinity_" + networkName + ".dot", "hetero_subgraphs_" + networkName + ".dot"}) {
+        std::remove(dumpName.c_str());
+    }
+    for (auto&& node : function->get_ordered_ops()) {
+        auto itExpected = expectedDevices.find(node->get_friendly_name());
+        if (itExpected == expectedDevices.end()) {
+            continue;
+        }
+        // the node label is "<name>\n<type>\ndevice=<device>"
+        const auto label = node->get_friendly_name() + "\\n" + node->get_type_name() + "\\ndevice=" + itExpected->second + "\\n";
+        ASSERT_NE(std::string::npos, content.find(label)) << label;
+    }
+}
+
+// the partitioned nodes of the function in the topological order
+static std::vector<std::shared_ptr<ngraph::Node>> PartitionedNodes(const std::shared_ptr<ngraph::Function>& function) {
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    for (auto&& node : function->get_ordered_ops()) {
+        // the function is shared with the affinity based tests
+        node->get_rt_info().erase("affinity");
+        if (!ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node)) {
+            nodes.push_back(node);
+        }
+    }
+    return nodes;
+}
+
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackByCostModel) {
+    auto& param = GetParam();
+    auto& pluginParameters = std::get<Plugin>(param);
+    auto& majorPluginNodeIds = std::get<Function>(param)._majorPluginNodeIds;
+    // the transfer is free, so the cost model should reproduce the split of the affinity based tests
+    std::map<std::string, std::string> devices;
+    for (auto&& node : PartitionedNodes(function)) {
+        const bool major = majorPluginNodeIds.end() != majorPluginNodeIds.find(node->get_friendly_name());
+        devices.emplace(node->get_friendly_name(), pluginParameters.at(major ? 0 : 1)._name);
+    }
+    CheckCostModelPartitioning(CONFIG_VALUE(LATENCY), devices, devices);
+}
+
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackByCostModelThroughput) {
+    auto& pluginParameters = std::get<Plugin>(GetParam());
+    // one stage per device: the first half of the topological order is cheap on the first device and the second half
+    // on the second one, the stage of any other split is at least 10 times slower
+    const auto nodes = PartitionedNodes(function);
+    std::map<std::string, std::string> devices;
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        devices.emplace(nodes[i]->get_friendly_name(), pluginParameters.at(i < nodes.size() / 2 ? 0 : 1)._name);
+    }
+    CheckCostModelPartitioning(CONFIG_VALUE(THROUGHPUT), devices, devices);
+}
+
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackByCostModelWithAffinity) {
+    auto& param = GetParam();
+    auto& pluginParameters = std::get<Plugin>(param);
+    auto& majorPluginNodeIds = std::get<Function>(param)._majorPluginNodeIds;
+    // the user affinity pins the first node to the device where it is expensive, the rest is left to the cost model
+    const auto nodes = PartitionedNodes(function);
+    std::map<std::string, std::string> cheapDevices;
+    for (auto&& node : nodes) {
+        const bool major = majorPluginNodeIds.end() != majorPluginNodeIds.find(node->get_friendly_name());
+        cheapDevices.emplace(node->get_friendly_name(), pluginParameters.at(major ? 0 : 1)._name);
+    }
+    auto expectedDevices = cheapDevices;
+    const auto& pinned = nodes.front()->get_friendly_name();
+    const auto& pinnedDevice = cheapDevices.at(pinned) == pluginParameters.at(0)._name ? pluginParameters.at(1)._name
+                                                                                       : pluginParameters.at(0)._name;
+    nodes.front()->get_rt_info()["affinity"] = pinnedDevice;
+    expectedDevices[pinned] = pinnedDevice;
+    CheckCostModelPartitioning(CONFIG_VALUE(LATENCY), cheapDevices, expectedDevices);
+    nodes.front()->get_rt_info().erase("affinity");
+}
+
 }  //  namespace HeteroTests
@@ -34,6 +34,12 @@ protected:
 public:
     static std::string getTestCaseName(const testing::TestParamInfo<ExperimentalDetectronDetectionOutputTestParams>& obj);
 };
+
+// The inputs of any shape are generated randomly, e.g. for the large proposal counts.
+class ExperimentalDetectronDetectionOutputRandomLayerTest : public ExperimentalDetectronDetectionOutputLayerTest {
+protected:
+    void generate_inputs(const std::vector<ngraph::Shape>& targetInputStaticShapes) override;
+};
 } // namespace subgraph
 } // namespace test
 } // namespace ov
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <random>
+
 #include "shared_test_classes/single_layer/experimental_detectron_detection_output.hpp"
 #include "ngraph_functions/builders.hpp"
 #include "common_test_utils/data_utils.hpp"
@@ -139,6 +141,40 @@ void ExperimentalDetectronDetectionOutputLayerTest::generate_inputs(const std::v
     }
 }
 
+void ExperimentalDetectronDetectionOutputRandomLayerTest::generate_inputs(
+        const std::vector<ngraph::Shape>& targetInputStaticShapes) {
+    // random boxes within the image and random deltas and scores
+    inputs.clear();
+    const auto& funcInputs = function->inputs();
+    const float imgH = 600.0f, imgW = 800.0f;
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    std::vector<ov::Tensor> tensors;
+    for (const auto& shape : targetInputStaticShapes)
+        tensors.emplace_back(ov::element::f32, shape);
+
+    auto* rois = tensors[0].data<float>();
+    for (size_t i = 0; i < shape_size(targetInputStaticShapes[0]); i += 4) {
+        rois[i + 0] = uniform(gen) * imgW * 0.9f;
+        rois[i + 1] = uniform(gen) * imgH * 0.9f;
+        rois[i + 2] = rois[i + 0] + 1.0f + uniform(gen) * imgW * 0.1f;
+        rois[i + 3] = rois[i + 1] + 1.0f + uniform(gen) * imgH * 0.1f;
+    }
+    auto* deltas = tensors[1].data<float>();
+    for (size_t i = 0; i < shape_size(targetInputStaticShapes[1]); ++i)
+        deltas[i] = uniform(gen) - 0.5f;
+    auto* scores = tensors[2].data<float>();
+    for (size_t i = 0; i < shape_size(targetInputStaticShapes[2]); ++i)
+        scores[i] = uniform(gen);
+    auto* imInfo = tensors[3].data<float>();
+    imInfo[0] = imgH;
+    imInfo[1] = imgW;
+    imInfo[2] = 1.0f;
+
+    for (auto i = 0ul; i < funcInputs.size(); ++i)
+        inputs.insert({funcInputs[i].get_node_shared_ptr(), tensors[i]});
+}
+
 } // namespace subgraph
 } // namespace test
 } // namespace ov
@@ -0,0 +1,101 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <weights_cache.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::vector<unsigned char> makeData(size_t size) {
+    std::vector<unsigned char> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<unsigned char>(i * 131 + 7);
+    return data;
+}
+
+}  // namespace
+
+TEST(SimpleDataHashTest, ReferenceValues) {
+    // Both SSE4.2 and generic implementations must give the same values, the hash is a part of persistent keys
+    const std::vector<std::pair<size_t, uint64_t>> refs = {
+        {0, 0xf8a5e4cef09b522e}, {1, 0xb892126cf4089055}, {7, 0xd441fa3d6ecea708},
+        {8, 0xbd67b118bdc4ade7}, {9, 0xb7152df8742f0ed4}, {31, 0x109a638bf0476569},
+        {32, 0x8ef3b668375d578f}, {33, 0x4d2838f6d75cefc2}, {100, 0xc349b78e9e3dc741},
+        {1000, 0xbf2d141e2273c7fa}};
+    const auto data = makeData(1000);
+    SimpleDataHash hashFunc;
+    for (const auto& ref : refs)
+        ASSERT_EQ(ref.second, hashFunc.hash(data.data(), ref.first)) << "size: " << ref.first;
+}
+
+TEST(SimpleDataHashTest, EveryByteAffectsHash) {
+    auto data = makeData(77);
+    SimpleDataHash hashFunc;
+    const auto ref = hashFunc.hash(data.data(), data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] ^= 1;
+        ASSERT_NE(ref, hashFunc.hash(data.data(), data.size())) << "byte: " << i;
+        data[i] ^= 1;
+    }
+}
+
+TEST(SimpleDataHashTest, ChunkedModeIsDeterministic) {
+    const size_t size = SimpleDataHash::kParallelThreshold + SimpleDataHash::kChunkSize / 2 + 3;
+    auto data = makeData(size);
+    SimpleDataHash hashFunc;
+    const auto ref = hashFunc.hash(data.data(), size);
+    for (int i = 0; i < 10; i++)
+        ASSERT_EQ(ref, hashFunc.hash(data.data(), size));
+
+    data[size - 1] ^= 1;
+    ASSERT_NE(ref, hashFunc.hash(data.data(), size));
+    data[size - 1] ^= 1;
+    ASSERT_NE(ref, hashFunc.hash(data.data(), size - 1));
+}
+
+TEST(SimpleDataHashTest, LargeBufferHashIsStable) {
+    // The large buffer is hashed by the chunks in parallel, the result must not depend on the scheduling
+    // or on the alignment of the data
+    const size_t size = 64 * 1024 * 1024 + 5;
+    const auto data = makeData(size);
+    SimpleDataHash hashFunc;
+    const auto ref = hashFunc.hash(data.data(), size);
+    for (int i = 0; i < 3; i++)
+        ASSERT_EQ(ref, hashFunc.hash(data.data(), size));
+
+    std::vector<unsigned char> shifted(size + 1);
+    std::copy(data.begin(), data.end(), shifted.begin() + 1);
+    ASSERT_EQ(ref, hashFunc.hash(shifted.data() + 1, size));
+
+    // the bytes around the chunk boundaries affect the hash
+    for (size_t pos : {SimpleDataHash::kChunkSize - 1, SimpleDataHash::kChunkSize, size / 2}) {
+        shifted[pos + 1] ^= 1;
+        ASSERT_NE(ref, hashFunc.hash(shifted.data() + 1, size)) << "byte: " << pos;
+        shifted[pos + 1] ^= 1;
+    }
+}
+
+TEST(SimpleDataHashTest, DISABLED_Throughput) {
+    // The throughput of the sequential and the chunked parallel modes is reported by the test properties
+    // (e.g. --gtest_output=xml), the test is run on demand with --gtest_also_run_disabled_tests
+    for (size_t size : {SimpleDataHash::kParallelThreshold / 2, size_t(256) * 1024 * 1024}) {
+        const auto data = makeData(size);
+        SimpleDataHash hashFunc;
+        const auto ref = hashFunc.hash(data.data(), size);
+        const size_t iterations = 10;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            ASSERT_EQ(ref, hashFunc.hash(data.data(), size));
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        const auto throughputMBps = static_cast<double>(size) * iterations / elapsed.count() / (1024 * 1024);
+        RecordProperty("MBps_" + std::to_string(size), std::to_string(throughputMBps));
+    }
+}
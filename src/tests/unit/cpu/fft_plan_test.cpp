@@ -0,0 +1,110 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "nodes/common/fft_plan.h"
+
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <algorithm>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::vector<std::complex<float>> generateData(size_t length) {
+    std::vector<std::complex<float>> data(length);
+    for (size_t i = 0; i < length; ++i)
+        data[i] = {std::sin(0.37f * i + 0.1f), std::cos(1.13f * i) * 0.5f};
+    return data;
+}
+
+std::vector<std::complex<double>> referenceDFT(const std::vector<std::complex<float>>& data, bool inverse) {
+    const size_t length = data.size();
+    const double PI = 3.141592653589793238462643;
+    std::vector<std::complex<double>> result(length);
+    for (size_t k = 0; k < length; ++k) {
+        std::complex<double> sum = 0;
+        for (size_t n = 0; n < length; ++n) {
+            const double angle = 2.0 * PI * static_cast<double>((n * k) % length) / length;
+            sum += std::complex<double>(data[n]) * std::complex<double>(std::cos(angle), (inverse ? 1 : -1) * std::sin(angle));
+        }
+        result[k] = sum;
+    }
+    return result;
+}
+
+void checkPlan(size_t length, bool inverse, bool parallelize = false) {
+    auto data = generateData(length);
+    const auto reference = referenceDFT(data, inverse);
+
+    FFTPlan plan(length, inverse);
+    std::vector<std::complex<float>> scratch(plan.scratchSize());
+    plan.execute(data.data(), scratch.data(), parallelize);
+
+    const double threshold = 1e-5 * std::sqrt(static_cast<double>(length)) * std::log2(2.0 * length);
+    for (size_t k = 0; k < length; ++k) {
+        ASSERT_NEAR(reference[k].real(), data[k].real(), threshold) << "length: " << length << " index: " << k;
+        ASSERT_NEAR(reference[k].imag(), data[k].imag(), threshold) << "length: " << length << " index: " << k;
+    }
+}
+
+void checkRoundTrip(size_t length, bool parallelize) {
+    const auto original = generateData(length);
+    auto data = original;
+
+    FFTPlan forward(length, false);
+    FFTPlan inverse(length, true);
+    std::vector<std::complex<float>> scratch(std::max(forward.scratchSize(), inverse.scratchSize()));
+    forward.execute(data.data(), scratch.data(), parallelize);
+    inverse.execute(data.data(), scratch.data(), parallelize);
+
+    for (size_t k = 0; k < length; ++k) {
+        ASSERT_NEAR(original[k].real(), data[k].real() / length, 1e-5) << "length: " << length << " index: " << k;
+        ASSERT_NEAR(original[k].imag(), data[k].imag() / length, 1e-5) << "length: " << length << " index: " << k;
+    }
+}
+
+}  // namespace
+
+TEST(FFTPlanTest, MatchesReferenceForSmallLengths) {
+    for (size_t length = 1; length <= 130; ++length) {
+        checkPlan(length, false);
+        checkPlan(length, true);
+    }
+}
+
+TEST(FFTPlanTest, MatchesReferenceForMixedRadixAndBluestein) {
+    // 2 * 3 * 5 * 7 * 11, 13 * 13, 2^10, the lengths with the large prime factors are executed with Bluestein algorithm
+    for (size_t length : {2310, 169, 1024, 1009, 2053, 2 * 1021}) {
+        checkPlan(length, false);
+        checkPlan(length, true);
+    }
+}
+
+TEST(FFTPlanTest, ParallelExecution) {
+    // 2^16, 3 * 5 * 7 * 11 * 13 and Bluestein on top of 2^17
+    for (size_t length : {1 << 16, 15015, 32771}) {
+        checkRoundTrip(length, true);
+    }
+}
+
+// The time of one transform is reported by the test properties (e.g. --gtest_output=xml)
+TEST(FFTPlanTest, DISABLED_Throughput) {
+    for (size_t length : {400, 512, 1000, 1021}) {
+        FFTPlan plan(length, false);
+        auto data = generateData(length);
+        std::vector<std::complex<float>> scratch(plan.scratchSize());
+        const size_t iterations = 20000;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+            plan.execute(data.data(), scratch.data());
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        RecordProperty("us_per_length_" + std::to_string(length), std::to_string(elapsed.count() / iterations));
+    }
+}
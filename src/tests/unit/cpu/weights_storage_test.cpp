@@ -0,0 +1,90 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpu_memory.h>
+#include <weights_cache.hpp>
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "common_test_utils/file_utils.hpp"
+
+#include <cstring>
+#include <numeric>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+class WeightsStorageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        storageDir = std::string("weights_storage_test_") +
+                     ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(storageDir, "blob");
+        CommonTestUtils::removeDir(storageDir);
+    }
+
+    MKLDNNMemoryPtr createMemory(const std::vector<float>& data, dnnl::memory::format_tag fmt) {
+        auto memory = std::make_shared<MKLDNNMemory>(eng);
+        memory->Create(DnnlBlockedMemoryDesc(Shape(VectorDims{2, 3, 4, 5}), dnnl::memory::data_type::f32, fmt), data.data());
+        return memory;
+    }
+
+    std::string storageDir;
+    dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+};
+
+TEST_F(WeightsStorageTest, StoreAndFind) {
+    std::vector<float> data(2 * 3 * 4 * 5);
+    std::iota(data.begin(), data.end(), 0.f);
+    auto src = createMemory(data, dnnl::memory::format_tag::abcd);
+    auto dst = createMemory(data, dnnl::memory::format_tag::abcd);
+
+    MKLDNNWeightsStorage storage(storageDir);
+    const auto key = MKLDNNWeightsStorage::makeKey(*src, dst->getDesc());
+    ASSERT_EQ(nullptr, storage.find(key, dst->GetSize()));
+
+    storage.store(key, *dst);
+
+    auto stored = storage.find(key, dst->GetSize());
+    ASSERT_NE(nullptr, stored);
+    ASSERT_EQ(0, std::memcmp(stored->data(), dst->GetData(), dst->GetSize()));
+    // an entry with unexpected size is ignored
+    ASSERT_EQ(nullptr, storage.find(key, dst->GetSize() + 1));
+}
+
+TEST_F(WeightsStorageTest, HashCollisionIsRejected) {
+    std::vector<float> data(2 * 3 * 4 * 5);
+    std::iota(data.begin(), data.end(), 0.f);
+    auto src = createMemory(data, dnnl::memory::format_tag::abcd);
+    auto dst = createMemory(data, dnnl::memory::format_tag::abcd);
+
+    MKLDNNWeightsStorage storage(storageDir);
+    const auto key = MKLDNNWeightsStorage::makeKey(*src, dst->getDesc());
+    // the entry of the other source data which name collides with the key
+    auto collidingKey = MKLDNNWeightsStorage::makeKey(*src, createMemory(data, dnnl::memory::format_tag::acdb)->getDesc());
+    ASSERT_NE(key.header, collidingKey.header);
+    collidingKey.name = key.name;
+    storage.store(collidingKey, *dst);
+
+    ASSERT_EQ(nullptr, storage.find(key, dst->GetSize()));
+    ASSERT_NE(nullptr, storage.find(collidingKey, dst->GetSize()));
+}
+
+TEST_F(WeightsStorageTest, KeyDependsOnDataAndDescriptors) {
+    std::vector<float> data(2 * 3 * 4 * 5, 1.f);
+    auto src = createMemory(data, dnnl::memory::format_tag::abcd);
+    const auto planarDesc = src->getDesc().clone();
+    const auto blockedDesc = createMemory(data, dnnl::memory::format_tag::acdb)->getDesc().clone();
+
+    const auto key = MKLDNNWeightsStorage::makeKey(*src, *planarDesc);
+    ASSERT_EQ(key.name, MKLDNNWeightsStorage::makeKey(*createMemory(data, dnnl::memory::format_tag::abcd), *planarDesc).name);
+    ASSERT_NE(key.name, MKLDNNWeightsStorage::makeKey(*src, *blockedDesc).name);
+
+    std::vector<float> otherData(data);
+    otherData.back() = 2.f;
+    ASSERT_NE(key.name, MKLDNNWeightsStorage::makeKey(*createMemory(otherData, dnnl::memory::format_tag::abcd), *planarDesc).name);
+}
@@ -10,6 +10,7 @@
 
 #include "compilation_context.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
@@ -403,6 +404,91 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantData) {
+    auto fun1 = create_simple_function();
+    auto fun2 = create_simple_function();
+    auto fun3 = create_simple_function();
+    auto replaceConstant = [](const std::shared_ptr<ngraph::Function>& fun, int8_t value) {
+        for (const auto& op : fun->get_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+                auto newConstant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {value});
+                newConstant->set_friendly_name(constant->get_friendly_name());
+                newConstant->get_output_tensor(0).set_names(constant->get_output_tensor(0).get_names());
+                ngraph::replace_node(constant, newConstant);
+                break;
+            }
+        }
+    };
+    replaceConstant(fun2, 5);
+    replaceConstant(fun3, 5);
+    ASSERT_NE(NetworkCompilationContext::computeHash(CNNNetwork(fun1), {}),
+              NetworkCompilationContext::computeHash(CNNNetwork(fun2), {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(CNNNetwork(fun2), {}),
+              NetworkCompilationContext::computeHash(CNNNetwork(fun3), {}));
+}
+
+static std::shared_ptr<ngraph::Function> createLargeFunction(float lastValue) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1024});
+    data->set_friendly_name("data");
+    std::shared_ptr<ngraph::Node> node = data;
+    for (int i = 0; i < 16; i++) {
+        std::vector<float> weights(1024 * 1024, static_cast<float>(i));
+        if (i == 15)
+            weights.back() = lastValue;
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1024, 1024}, weights);
+        constant->set_friendly_name("weights_" + std::to_string(i));
+        node = std::make_shared<ngraph::opset6::MatMul>(node, constant);
+        node->set_friendly_name("matmul_" + std::to_string(i));
+    }
+    auto res = std::make_shared<ngraph::opset6::Result>(node);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+}
+
+// The first hash calculation hashes the constants data, the next ones reuse the memoized per-Constant values,
+// both must give the same result as the hash of the same model built from scratch.
+TEST(NetworkContext_CNNNetwork, HashOfLargeModel) {
+    auto fun = createLargeFunction(15.f);
+    const auto hash = NetworkCompilationContext::computeHash(CNNNetwork(fun), {});
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(CNNNetwork(fun), {}));
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(CNNNetwork(ngraph::clone_function(*fun)), {}));
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(CNNNetwork(createLargeFunction(15.f)), {}));
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(CNNNetwork(createLargeFunction(0.f)), {}));
+}
+
+// The constants data are hashed only once: the in-place change of the data after the first hash calculation is
+// not seen by the next one, while the model built with the changed data gets the other hash.
+TEST(NetworkContext_CNNNetwork, ConstantDataHashIsNotRecomputed) {
+    CNNNetwork net(createLargeFunction(15.f));
+    const auto hash = NetworkCompilationContext::computeHash(net, {});
+    for (const auto& op : net.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+            auto data = static_cast<float*>(const_cast<void*>(constant->get_data_ptr()));
+            if (data[shape_size(constant->get_shape()) - 1] == 15.f)
+                data[shape_size(constant->get_shape()) - 1] = 0.f;
+        }
+    }
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(net, {}));
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(CNNNetwork(createLargeFunction(0.f)), {}));
+}
+
+// Measures the hash calculation which happens on each compilation with enabled cache, including a cache hit:
+// the first calculation hashes the constants data, the next ones reuse the memoized values.
+// The times are reported by the test properties (e.g. --gtest_output=xml).
+TEST(NetworkContext_CNNNetwork, DISABLED_HashOfLargeModelPerf) {
+    CNNNetwork net(createLargeFunction(15.f));
+    auto measure = [&net](std::string& hash) {
+        auto start = high_resolution_clock::now();
+        hash = NetworkCompilationContext::computeHash(net, {});
+        return duration_cast<microseconds>(high_resolution_clock::now() - start).count();
+    };
+    std::string firstHash, nextHash;
+    const auto firstTime = measure(firstHash);
+    const auto nextTime = measure(nextHash);
+    ASSERT_EQ(firstHash, nextHash);
+    RecordProperty("first_us", std::to_string(firstTime));
+    RecordProperty("next_us", std::to_string(nextTime));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "ie_mapped_memory_stream.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+class StringMemory : public ov::util::MappedMemory {
+public:
+    explicit StringMemory(std::string data) : m_data(std::move(data)) {}
+
+    char* data() noexcept override {
+        return &m_data[0];
+    }
+
+    size_t size() const noexcept override {
+        return m_data.size();
+    }
+
+private:
+    std::string m_data;
+};
+}  // namespace
+
+TEST(MappedMemoryStreamTest, canReadAndSeek) {
+    auto memory = std::make_shared<StringMemory>("header\n0123456789");
+    MappedMemoryStream stream(memory);
+    ASSERT_EQ(memory, stream.getMemory());
+
+    std::string line;
+    std::getline(stream, line);
+    ASSERT_EQ("header", line);
+    ASSERT_EQ(7, stream.tellg());
+
+    stream.seekg(10);
+    char buf[3];
+    stream.read(buf, sizeof(buf));
+    ASSERT_EQ("345", std::string(buf, sizeof(buf)));
+
+    stream.seekg(-2, std::ios_base::end);
+    stream.read(buf, 2);
+    ASSERT_EQ("89", std::string(buf, 2));
+
+    stream.seekg(-4, std::ios_base::cur);
+    ASSERT_EQ(13, stream.tellg());
+}
+
+TEST(MappedMemoryStreamTest, cannotSeekOutOfMemory) {
+    MappedMemoryStream stream(std::make_shared<StringMemory>("0123"));
+    stream.seekg(5);
+    ASSERT_TRUE(stream.fail());
+
+    stream.clear();
+    stream.seekg(0);
+    char buf[8];
+    stream.read(buf, sizeof(buf));
+    ASSERT_EQ(4, stream.gcount());
+    ASSERT_TRUE(stream.eof());
+}